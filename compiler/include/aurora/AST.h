@@ -1,5 +1,6 @@
 #pragma once
 
+#include "aurora/ASTArena.h"
 #include "aurora/Type.h"
 #include <memory>
 #include <string>
@@ -13,7 +14,8 @@ class Function;
 namespace aurora {
 
 /// Base class for all AST nodes
-class ASTNode {
+/// Nodes are bump-allocated from the active ASTArena (see ASTArena.h)
+class ASTNode : public ASTAllocated {
 public:
     virtual ~ASTNode() = default;
     virtual llvm::Value* codegen() = 0;
@@ -23,7 +25,7 @@ public:
 class Expr : public ASTNode {
 public:
     virtual ~Expr() = default;
-    virtual std::shared_ptr<Type> getType() const = 0;
+    virtual Type* getType() const = 0;
 };
 
 /// Integer literal (e.g., 42)
@@ -32,7 +34,7 @@ public:
     explicit IntLiteralExpr(int64_t val) : value(val) {}
     
     llvm::Value* codegen() override;
-    std::shared_ptr<Type> getType() const override;
+    Type* getType() const override;
     int64_t getValue() const { return value; }
 
 private:
@@ -45,7 +47,7 @@ public:
     explicit DoubleLiteralExpr(double val) : value(val) {}
     
     llvm::Value* codegen() override;
-    std::shared_ptr<Type> getType() const override;
+    Type* getType() const override;
     double getValue() const { return value; }
 
 private:
@@ -58,16 +60,16 @@ private:
 /// Variable reference (e.g., x, myVar)
 class VariableExpr : public Expr {
 public:
-    VariableExpr(std::string n, std::shared_ptr<Type> t)
+    VariableExpr(std::string n, Type* t)
         : name(std::move(n)), type(std::move(t)) {}
     
     llvm::Value* codegen() override;
-    std::shared_ptr<Type> getType() const override;
+    Type* getType() const override;
     const std::string& getName() const { return name; }
 
 private:
     std::string name;
-    mutable std::shared_ptr<Type> type;  // mutable for lazy type resolution
+    mutable Type* type;  // mutable for lazy type resolution
 };
 
 /// Boolean literal (true, false)
@@ -76,7 +78,7 @@ public:
     explicit BoolExpr(bool v) : value(v) {}
     
     llvm::Value* codegen() override;
-    std::shared_ptr<Type> getType() const override;
+    Type* getType() const override;
     bool getValue() const { return value; }
 
 private:
@@ -89,11 +91,11 @@ public:
     NullExpr();
     
     llvm::Value* codegen() override;
-    std::shared_ptr<Type> getType() const override;
-    void setResolvedType(std::shared_ptr<Type> t);
+    Type* getType() const override;
+    void setResolvedType(Type* t);
 
 private:
-    std::shared_ptr<Type> resolvedType;
+    Type* resolvedType;
 };
 
 /// String literal (e.g., "hello")
@@ -102,7 +104,7 @@ public:
     explicit StringExpr(std::string v) : value(std::move(v)) {}
     
     llvm::Value* codegen() override;
-    std::shared_ptr<Type> getType() const override;
+    Type* getType() const override;
     const std::string& getValue() const { return value; }
 
 private:
@@ -129,7 +131,7 @@ public:
         : op(o), left(std::move(l)), right(std::move(r)) {}
     
     llvm::Value* codegen() override;
-    std::shared_ptr<Type> getType() const override;
+    Type* getType() const override;
     
     Op getOp() const { return op; }
     Expr* getLeft() const { return left.get(); }
@@ -152,9 +154,10 @@ public:
     
     UnaryExpr(Op o, std::unique_ptr<Expr> e)
         : op(o), expr(std::move(e)) {}
-    
+
     llvm::Value* codegen() override;
-    std::shared_ptr<Type> getType() const override;
+    Type* getType() const override;
+    Expr* getExpr() const { return expr.get(); }
 
 private:
     Op op;
@@ -164,17 +167,17 @@ private:
 /// Array literal expression (e.g., [1, 2, 3, 4])
 class ArrayLiteralExpr : public Expr {
 public:
-    ArrayLiteralExpr(std::vector<std::unique_ptr<Expr>> elems, std::shared_ptr<Type> t)
+    ArrayLiteralExpr(std::vector<std::unique_ptr<Expr>> elems, Type* t)
         : elements(std::move(elems)), type(std::move(t)) {}
     
     llvm::Value* codegen() override;
-    std::shared_ptr<Type> getType() const override { return type; }
+    Type* getType() const override { return type; }
     
     const std::vector<std::unique_ptr<Expr>>& getElements() const { return elements; }
 
 private:
     std::vector<std::unique_ptr<Expr>> elements;
-    std::shared_ptr<Type> type;
+    Type* type;
 };
 
 /// Array index expression (e.g., arr[0], matrix[i][j])
@@ -184,7 +187,7 @@ public:
         : array(std::move(arr)), index(std::move(idx)) {}
     
     llvm::Value* codegen() override;
-    std::shared_ptr<Type> getType() const override;
+    Type* getType() const override;
     
     Expr* getArray() const { return array.get(); }
     Expr* getIndex() const { return index.get(); }
@@ -199,9 +202,13 @@ class TernaryExpr : public Expr {
 public:
     TernaryExpr(std::unique_ptr<Expr> c, std::unique_ptr<Expr> t, std::unique_ptr<Expr> f)
         : condition(std::move(c)), trueExpr(std::move(t)), falseExpr(std::move(f)) {}
-    
+
     llvm::Value* codegen() override;
-    std::shared_ptr<Type> getType() const override;
+    Type* getType() const override;
+
+    Expr* getCondition() const { return condition.get(); }
+    Expr* getTrueExpr() const { return trueExpr.get(); }
+    Expr* getFalseExpr() const { return falseExpr.get(); }
 
 private:
     std::unique_ptr<Expr> condition;
@@ -216,8 +223,9 @@ public:
         : object(std::move(o)), member(std::move(m)) {}
     
     llvm::Value* codegen() override;
-    std::shared_ptr<Type> getType() const override;
-    
+    Type* getType() const override;
+
+    Expr* getObject() const { return object.get(); }
     const std::string& getMember() const { return member; }
 
 private:
@@ -230,9 +238,10 @@ class ForceUnwrapExpr : public Expr {
 public:
     explicit ForceUnwrapExpr(std::unique_ptr<Expr> e)
         : expr(std::move(e)) {}
-    
+
     llvm::Value* codegen() override;
-    std::shared_ptr<Type> getType() const override;
+    Type* getType() const override;
+    Expr* getExpr() const { return expr.get(); }
 
 private:
     std::unique_ptr<Expr> expr;
@@ -241,11 +250,11 @@ private:
 /// Function call (e.g., foo(a, b))
 class CallExpr : public Expr {
 public:
-    CallExpr(std::string c, std::vector<std::unique_ptr<Expr>> a, std::shared_ptr<Type> t)
+    CallExpr(std::string c, std::vector<std::unique_ptr<Expr>> a, Type* t)
         : callee(std::move(c)), args(std::move(a)), type(std::move(t)) {}
     
     llvm::Value* codegen() override;
-    std::shared_ptr<Type> getType() const override { return type; }
+    Type* getType() const override { return type; }
     
     const std::string& getCallee() const { return callee; }
     const std::vector<std::unique_ptr<Expr>>& getArgs() const { return args; }
@@ -253,7 +262,7 @@ public:
 private:
     std::string callee;
     std::vector<std::unique_ptr<Expr>> args;
-    std::shared_ptr<Type> type;
+    Type* type;
 };
 
 /// Null check (e.g., x?)
@@ -261,9 +270,10 @@ class NullCheckExpr : public Expr {
 public:
     explicit NullCheckExpr(std::unique_ptr<Expr> e)
         : expr(std::move(e)) {}
-    
+
     llvm::Value* codegen() override;
-    std::shared_ptr<Type> getType() const override;
+    Type* getType() const override;
+    Expr* getExpr() const { return expr.get(); }
 
 private:
     std::unique_ptr<Expr> expr;
@@ -272,11 +282,11 @@ private:
 /// Member access expression (e.g., obj.field or obj.method())
 class MemberAccessExpr : public Expr {
 public:
-    MemberAccessExpr(std::unique_ptr<Expr> obj, std::string mem, std::shared_ptr<Type> t)
+    MemberAccessExpr(std::unique_ptr<Expr> obj, std::string mem, Type* t)
         : object(std::move(obj)), member(std::move(mem)), type(std::move(t)) {}
     
     llvm::Value* codegen() override;
-    std::shared_ptr<Type> getType() const override { return type; }
+    Type* getType() const override { return type; }
     
     Expr* getObject() const { return object.get(); }
     const std::string& getMember() const { return member; }
@@ -284,19 +294,19 @@ public:
 private:
     std::unique_ptr<Expr> object;
     std::string member;
-    std::shared_ptr<Type> type;
+    Type* type;
 };
 
 /// Member method call expression (e.g., obj.method(args))
 class MemberCallExpr : public Expr {
 public:
     MemberCallExpr(std::unique_ptr<Expr> obj, std::string meth, 
-                   std::vector<std::unique_ptr<Expr>> a, std::shared_ptr<Type> t)
+                   std::vector<std::unique_ptr<Expr>> a, Type* t)
         : object(std::move(obj)), method(std::move(meth)), 
           args(std::move(a)), type(std::move(t)) {}
     
     llvm::Value* codegen() override;
-    std::shared_ptr<Type> getType() const override;
+    Type* getType() const override;
     
     Expr* getObject() const { return object.get(); }
     const std::string& getMethod() const { return method; }
@@ -306,17 +316,17 @@ private:
     std::unique_ptr<Expr> object;
     std::string method;
     std::vector<std::unique_ptr<Expr>> args;
-    mutable std::shared_ptr<Type> type;  // mutable for lazy type resolution
+    mutable Type* type;  // mutable for lazy type resolution
 };
 
 /// New expression for creating class instances (e.g., new MyClass(args))
 class NewExpr : public Expr {
 public:
-    NewExpr(std::string className, std::vector<std::unique_ptr<Expr>> a, std::shared_ptr<Type> t)
+    NewExpr(std::string className, std::vector<std::unique_ptr<Expr>> a, Type* t)
         : className(std::move(className)), args(std::move(a)), type(std::move(t)) {}
     
     llvm::Value* codegen() override;
-    std::shared_ptr<Type> getType() const override { return type; }
+    Type* getType() const override { return type; }
     
     const std::string& getClassName() const { return className; }
     const std::vector<std::unique_ptr<Expr>>& getArgs() const { return args; }
@@ -324,19 +334,19 @@ public:
 private:
     std::string className;
     std::vector<std::unique_ptr<Expr>> args;
-    std::shared_ptr<Type> type;
+    Type* type;
 };
 
 /// This expression (refers to current object in methods)
 class ThisExpr : public Expr {
 public:
-    explicit ThisExpr(std::shared_ptr<Type> t) : type(std::move(t)) {}
+    explicit ThisExpr(Type* t) : type(std::move(t)) {}
     
     llvm::Value* codegen() override;
-    std::shared_ptr<Type> getType() const override { return type; }
+    Type* getType() const override { return type; }
 
 private:
-    std::shared_ptr<Type> type;
+    Type* type;
 };
 
 /// Statement base class
@@ -363,8 +373,9 @@ class ExprStmt : public Stmt {
 public:
     explicit ExprStmt(std::unique_ptr<Expr> e)
         : expr(std::move(e)) {}
-    
+
     llvm::Value* codegen() override;
+    Expr* getExpr() const { return expr.get(); }
 
 private:
     std::unique_ptr<Expr> expr;
@@ -373,19 +384,19 @@ private:
 /// Variable declaration (let x: int = 42;)
 class VarDeclStmt : public Stmt {
 public:
-    VarDeclStmt(std::string n, std::shared_ptr<Type> t, std::unique_ptr<Expr> i, bool mut)
+    VarDeclStmt(std::string n, Type* t, std::unique_ptr<Expr> i, bool mut)
         : name(std::move(n)), type(std::move(t)), init(std::move(i)), mutable_(mut) {}
     
     llvm::Value* codegen() override;
     
     const std::string& getName() const { return name; }
-    std::shared_ptr<Type> getType() const { return type; }
+    Type* getType() const { return type; }
     Expr* getInit() const { return init.get(); }
     bool isMutable() const { return mutable_; }
 
 private:
     std::string name;
-    std::shared_ptr<Type> type;
+    Type* type;
     std::unique_ptr<Expr> init;
     bool mutable_;
 };
@@ -399,12 +410,43 @@ public:
     
     llvm::Value* codegen() override;
 
+    Expr* getCondition() const { return condition.get(); }
+    const std::vector<std::unique_ptr<Stmt>>& getThenBranch() const { return thenBranch; }
+    const std::vector<std::unique_ptr<Stmt>>& getElseBranch() const { return elseBranch; }
+
 private:
     std::unique_ptr<Expr> condition;
     std::vector<std::unique_ptr<Stmt>> thenBranch;
     std::vector<std::unique_ptr<Stmt>> elseBranch;
 };
 
+/// One arm of a match statement: one or more literal patterns sharing a body
+struct MatchArm {
+    std::vector<std::unique_ptr<Expr>> patterns;
+    std::vector<std::unique_ptr<Stmt>> body;
+};
+
+/// Match statement: dispatches over integer or string literal patterns.
+/// Integer matches lower to a single switch so LLVM can build jump tables;
+/// string matches dispatch on a hash of the subject (see StmtCodeGen.cpp).
+class MatchStmt : public Stmt {
+public:
+    MatchStmt(std::unique_ptr<Expr> s, std::vector<MatchArm> a,
+              std::vector<std::unique_ptr<Stmt>> d)
+        : subject(std::move(s)), arms(std::move(a)), defaultBody(std::move(d)) {}
+
+    llvm::Value* codegen() override;
+
+    Expr* getSubject() const { return subject.get(); }
+    const std::vector<MatchArm>& getArms() const { return arms; }
+    const std::vector<std::unique_ptr<Stmt>>& getDefaultBody() const { return defaultBody; }
+
+private:
+    std::unique_ptr<Expr> subject;
+    std::vector<MatchArm> arms;
+    std::vector<std::unique_ptr<Stmt>> defaultBody;
+};
+
 /// While statement
 class WhileStmt : public Stmt {
 public:
@@ -413,6 +455,9 @@ public:
     
     llvm::Value* codegen() override;
 
+    Expr* getCondition() const { return condition.get(); }
+    const std::vector<std::unique_ptr<Stmt>>& getBody() const { return body; }
+
 private:
     std::unique_ptr<Expr> condition;
     std::vector<std::unique_ptr<Stmt>> body;
@@ -427,8 +472,12 @@ public:
           endExpr(std::move(end)), stepExpr(std::move(step)), body(std::move(b)) {}
     
     llvm::Value* codegen() override;
-    
+
     const std::string& getVarName() const { return varName; }
+    Expr* getStartExpr() const { return startExpr.get(); }
+    Expr* getEndExpr() const { return endExpr.get(); }
+    Expr* getStepExpr() const { return stepExpr.get(); }
+    const std::vector<std::unique_ptr<Stmt>>& getBody() const { return body; }
 
 private:
     std::string varName;
@@ -443,9 +492,11 @@ class LoopStmt : public Stmt {
 public:
     explicit LoopStmt(std::vector<std::unique_ptr<Stmt>> b)
         : body(std::move(b)) {}
-    
+
     llvm::Value* codegen() override;
 
+    const std::vector<std::unique_ptr<Stmt>>& getBody() const { return body; }
+
 private:
     std::vector<std::unique_ptr<Stmt>> body;
 };
@@ -485,23 +536,23 @@ private:
 /// Function parameter
 struct Parameter {
     std::string name;
-    std::shared_ptr<Type> type;
+    Type* type;
     
-    Parameter(std::string n, std::shared_ptr<Type> t)
+    Parameter(std::string n, Type* t)
         : name(std::move(n)), type(std::move(t)) {}
 };
 
 /// Function prototype
-class Prototype {
+class Prototype : public ASTAllocated {
 public:
-    Prototype(std::string n, std::vector<Parameter> p, std::shared_ptr<Type> r)
+    Prototype(std::string n, std::vector<Parameter> p, Type* r)
         : name(std::move(n)), params(std::move(p)), returnType(std::move(r)), line_(0), column_(0) {}
     
     llvm::Function* codegen();
     
     const std::string& getName() const { return name; }
     const std::vector<Parameter>& getParams() const { return params; }
-    std::shared_ptr<Type> getReturnType() const { return returnType; }
+    Type* getReturnType() const { return returnType; }
     
     void setLocation(size_t line, size_t col) { line_ = line; column_ = col; }
     size_t getLine() const { return line_; }
@@ -510,13 +561,13 @@ public:
 private:
     std::string name;
     std::vector<Parameter> params;
-    std::shared_ptr<Type> returnType;
+    Type* returnType;
     size_t line_;
     size_t column_;
 };
 
 /// Function definition
-class Function {
+class Function : public ASTAllocated {
 public:
     Function(std::unique_ptr<Prototype> p, std::vector<std::unique_ptr<Stmt>> b)
         : proto(std::move(p)), body(std::move(b)) {}
@@ -534,11 +585,11 @@ private:
 /// Field declaration in a class
 struct FieldDecl {
     std::string name;
-    std::shared_ptr<Type> type;
+    Type* type;
     bool isPublic;
     std::unique_ptr<Expr> initializer;  // Optional default value
     
-    FieldDecl(std::string n, std::shared_ptr<Type> t, bool pub, std::unique_ptr<Expr> init = nullptr)
+    FieldDecl(std::string n, Type* t, bool pub, std::unique_ptr<Expr> init = nullptr)
         : name(std::move(n)), type(std::move(t)), isPublic(pub), initializer(std::move(init)) {}
 };
 
@@ -546,13 +597,13 @@ struct FieldDecl {
 struct MethodDecl {
     std::string name;
     std::vector<Parameter> params;
-    std::shared_ptr<Type> returnType;
+    Type* returnType;
     std::vector<std::unique_ptr<Stmt>> body;
     bool isPublic;
     bool isStatic;
     bool isConstructor;
     
-    MethodDecl(std::string n, std::vector<Parameter> p, std::shared_ptr<Type> ret, 
+    MethodDecl(std::string n, std::vector<Parameter> p, Type* ret, 
                std::vector<std::unique_ptr<Stmt>> b, bool pub, bool stat, bool ctor = false)
         : name(std::move(n)), params(std::move(p)), returnType(std::move(ret)),
           body(std::move(b)), isPublic(pub), isStatic(stat), isConstructor(ctor) {}
@@ -561,7 +612,7 @@ struct MethodDecl {
 };
 
 /// Class declaration
-class ClassDecl {
+class ClassDecl : public ASTAllocated {
 public:
     ClassDecl(std::string n, std::vector<FieldDecl> f, std::vector<MethodDecl> m, bool isObj = false)
         : name(std::move(n)), fields(std::move(f)), methods(std::move(m)), isSingleton(isObj), line_(0), column_(0) {}
@@ -582,7 +633,7 @@ public:
     FieldDecl* findField(const std::string& fieldName);
     MethodDecl* findMethod(const std::string& methodName);
     MethodDecl* findMethod(const std::string& methodName, 
-                          const std::vector<std::shared_ptr<Type>>& paramTypes);
+                          const std::vector<Type*>& paramTypes);
     
     // Generate implicit constructor if no explicit constructor exists
     void generateImplicitConstructor();
@@ -597,7 +648,7 @@ private:
 };
 
 /// Package declaration
-class PackageDecl {
+class PackageDecl : public ASTAllocated {
 public:
     explicit PackageDecl(std::string name) : packageName(std::move(name)) {}
     
@@ -611,7 +662,7 @@ private:
 };
 
 /// Import declaration
-class ImportDecl {
+class ImportDecl : public ASTAllocated {
 public:
     explicit ImportDecl(std::string path) : modulePath(std::move(path)) {}
     
@@ -631,4 +682,8 @@ void addModuleSearchPath(const std::string& path);
 void setStdlibPath(const std::string& path);
 void initializeModuleSystem();
 
+/// Resolved .aur files of every module loaded so far (watch mode uses
+/// this as the dependency set of the current compilation)
+std::vector<std::string> getLoadedModuleFiles();
+
 } // namespace aurora
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace aurora {
+
+/// Bump allocator that owns the memory of every AST node in a compilation
+/// unit. Nodes are allocated contiguously from large blocks and the whole
+/// unit is freed in one shot when the arena is destroyed, replacing the
+/// per-node malloc/free traffic of plain operator new.
+class ASTArena {
+public:
+    ASTArena();
+    ~ASTArena();
+
+    ASTArena(const ASTArena&) = delete;
+    ASTArena& operator=(const ASTArena&) = delete;
+
+    /// Allocate raw storage from the arena (max_align_t aligned)
+    void* allocate(size_t size);
+
+    /// Total bytes handed out (for --debug statistics)
+    size_t bytesAllocated() const { return bytes_allocated_; }
+
+    /// The arena currently active on this thread, or nullptr
+    static ASTArena* current();
+
+private:
+    friend class ASTArenaScope;
+
+    struct Block {
+        char* data;
+        size_t size;
+        size_t used;
+    };
+
+    void addBlock(size_t min_size);
+
+    std::vector<Block> blocks_;
+    size_t next_block_size_;
+    size_t bytes_allocated_;
+};
+
+/// RAII scope that makes an arena the allocation target for AST nodes
+/// created on the current thread. Scopes nest: the previous arena is
+/// restored on destruction.
+class ASTArenaScope {
+public:
+    explicit ASTArenaScope(ASTArena& arena);
+    ~ASTArenaScope();
+
+    ASTArenaScope(const ASTArenaScope&) = delete;
+    ASTArenaScope& operator=(const ASTArenaScope&) = delete;
+
+private:
+    ASTArena* previous_;
+};
+
+/// Mixin that routes node allocation into the active ASTArena.
+/// Each allocation carries a one-word prefix recording its origin, so
+/// operator delete stays correct for nodes created outside any arena
+/// scope (those fall back to the global heap).
+class ASTAllocated {
+public:
+    void* operator new(size_t size);
+    void operator delete(void* ptr);
+};
+
+} // namespace aurora
@@ -6,21 +6,36 @@
 #include <llvm/IR/Value.h>
 #include <llvm/IR/BasicBlock.h>
 #include <llvm/ExecutionEngine/Orc/LLJIT.h>
+#include "aurora/ObjectCache.h"
+#include "aurora/SymbolTable.h"
 #include <memory>
 #include <map>
+#include <set>
 #include <string>
 #include <vector>
 
 namespace aurora {
 
-// Forward declaration
+// Forward declarations
 class Type;
+class Expr;
+class NewExpr;
+class MemberCallExpr;
 
 /// Loop context for tracking break/continue targets
 struct LoopContext {
     llvm::BasicBlock* breakTarget;    // Where break jumps to (after loop)
     llvm::BasicBlock* continueTarget; // Where continue jumps to (loop condition)
-    
+
+    // Counted-loop facts for bounds-check elision. `counted` is set when
+    // this is a simple `for v in a..b` with constant non-negative bounds,
+    // the default +1 step, and a body that never writes v, so v stays in
+    // [constLower, constUpper) throughout the body.
+    std::string inductionVar;
+    int64_t constLower = 0;
+    int64_t constUpper = 0;
+    bool counted = false;
+
     LoopContext(llvm::BasicBlock* brk, llvm::BasicBlock* cont)
         : breakTarget(brk), continueTarget(cont) {}
 };
@@ -34,14 +49,15 @@ public:
     llvm::IRBuilder<>& getBuilder() { return *builder_; }
     llvm::Module& getModule() { return *module_; }
     
-    // Symbol table for variables
-    std::map<std::string, llvm::AllocaInst*>& getNamedValues() { return named_values_; }
-    
+    // Symbol table for variables (flat scoped storage, see SymbolTable.h)
+    FlatSymbolTable<llvm::AllocaInst*>& getNamedValues() { return named_values_; }
+
     // Type table for variables (Aurora types)
-    void setVariableType(const std::string& name, std::shared_ptr<Type> type) { variable_types_[name] = type; }
-    std::shared_ptr<Type> getVariableType(const std::string& name) {
-        auto it = variable_types_.find(name);
-        return (it != variable_types_.end()) ? it->second : nullptr;
+    void setVariableType(const std::string& name, Type* type) {
+        variable_types_.insert(name, type);
+    }
+    Type* getVariableType(const std::string& name) {
+        return variable_types_.lookup(name);
     }
     
     // Create an alloca instruction in the entry block of the function
@@ -58,7 +74,37 @@ public:
     void popLoopContext();
     LoopContext* getCurrentLoop();
     bool isInLoop() const { return !loop_stack_.empty(); }
-    
+
+    // Innermost loop whose induction variable is `var`, or nullptr when
+    // there is none (or the binding is shadowed by a non-counted loop)
+    const LoopContext* findCountedLoop(const std::string& var) const;
+
+    // Array bounds checking. Lengths of immutable literal-initialized
+    // arrays are recorded so subscript lowering can prove accesses in
+    // range and skip the runtime check; everything else gets an inline
+    // length compare that panics on out-of-bounds indices.
+    void setStaticArrayLength(const std::string& name, int64_t length);
+    int64_t getStaticArrayLength(const std::string& name) const;  // -1 when unknown
+    void clearStaticArrayLengths();
+    bool arrayIndexProvablySafe(const Expr* array, const Expr* index) const;
+    void insertArrayBoundsCheck(llvm::Value* arrayVal, llvm::Value* indexVal);
+    
+    // Interned string literals. Each distinct literal is emitted once
+    // as an immortal constant AuroraString (refcount flagged so
+    // retain/release are no-ops); repeated uses share the one global
+    // and allocate nothing at runtime.
+    llvm::Constant* getOrCreateInternedString(const std::string& value);
+
+    // Escape analysis results for the function being lowered (see
+    // EscapeAnalysis.h). NewExpr lowering places proven-local objects
+    // in an entry-block alloca instead of calling malloc.
+    void setStackAllocatableNews(std::set<const NewExpr*> news) {
+        stack_allocatable_news_ = std::move(news);
+    }
+    bool isStackAllocatable(const NewExpr* expr) const {
+        return stack_allocatable_news_.count(expr) != 0;
+    }
+
     // Memory management (ARC - Automatic Reference Counting)
     void pushScope();
     void popScope();
@@ -68,42 +114,122 @@ public:
     void releaseAllInScope();
     bool needsMemoryManagement(llvm::Type* type);
     
+    // Optimization level (0-3, like -O0..-O3); default is 2
+    void setOptimizationLevel(int level) { opt_level_ = level; }
+    int getOptimizationLevel() const { return opt_level_; }
+
+    // Run the standard optimization pipeline over the module
+    void optimizeModule();
+
+    // Target CPU for JIT and AOT code generation. Default "native"
+    // detects the host CPU and its feature set (AVX2/AVX-512 machines
+    // get real vector code); an explicit name ("generic", "skylake",
+    // "apple-m1", ...) pins codegen for reproducible cross builds.
+    void setTargetCPU(const std::string& cpu) { target_cpu_ = cpu; }
+    const std::string& getTargetCPU() const { return target_cpu_; }
+
+    // AOT compilation: emit a native object file, or a linked executable
+    // (object emission plus a link against the runtime/stdlib archives)
+    bool emitObjectFile(const std::string& path);
+    bool emitExecutable(const std::string& path);
+
+    // Persistent JIT object cache (on by default; see ObjectCache.h)
+    void setJITCacheEnabled(bool enabled) { jit_cache_enabled_ = enabled; }
+
+    // Lazy JIT: compile functions on first call instead of up front
+    void setLazyJIT(bool lazy) { lazy_jit_ = lazy; }
+
+    // Profile-guided JIT: instrument cheap function-entry counters into
+    // the jitted code, persist the counts at exit, and on later runs
+    // feed them back as hot/cold attributes so the inliner and block
+    // placement follow the program's real behavior instead of static
+    // heuristics (see the Profile-Guided JIT section in CodeGen.cpp)
+    void setProfileGuidedJIT(bool enabled) { pgo_jit_ = enabled; }
+
+    // ARC optimization: elide provably-paired retain/release calls
+    void setARCOptEnabled(bool enabled) { arc_opt_enabled_ = enabled; }
+
     // JIT compilation and execution
     void initializeJIT();
     int runMain();
     
-    void pushFunctionReturnType(std::shared_ptr<Type> type);
+    void pushFunctionReturnType(Type* type);
     void popFunctionReturnType();
-    std::shared_ptr<Type> currentFunctionReturnType() const;
+    Type* currentFunctionReturnType() const;
     
 private:
     std::unique_ptr<llvm::LLVMContext> context_;
     std::unique_ptr<llvm::IRBuilder<>> builder_;
     std::unique_ptr<llvm::Module> module_;
-    std::map<std::string, llvm::AllocaInst*> named_values_;
-    std::map<std::string, std::shared_ptr<Type>> variable_types_;  // Aurora types for variables
+    FlatSymbolTable<llvm::AllocaInst*> named_values_;
+    FlatSymbolTable<Type*> variable_types_;  // Aurora types for variables
     std::map<std::string, llvm::Function*> functions_;
     
     // Loop context stack for break/continue
     std::vector<LoopContext> loop_stack_;
+
+    // Statically-known array lengths for bounds-check elision, scoped in
+    // lockstep with named_values_ so a shadowing declaration can never
+    // leave a stale length behind after its scope exits. Entries are
+    // stored as length + 1 because the table's zero default means
+    // "no entry".
+    FlatSymbolTable<int64_t> static_array_lengths_;
+
+    // NewExprs of the current function proven not to escape
+    std::set<const NewExpr*> stack_allocatable_news_;
+
+    // One immortal constant AuroraString per distinct literal value
+    std::map<std::string, llvm::GlobalVariable*> interned_strings_;
     
-    // Memory management: track variables that need release at scope end
+    // Memory management: track variables that need release at scope end.
+    // The marks snapshot the name/type tables so popScope can drop the
+    // scope's bindings (and restore shadowed ones) in O(bindings made).
     struct ScopeVariables {
         std::vector<std::pair<std::string, llvm::Value*>> variables;
+        size_t named_values_mark = 0;
+        size_t variable_types_mark = 0;
+        size_t static_lengths_mark = 0;
     };
     std::vector<ScopeVariables> scope_stack_;
     
     // JIT engine
     std::unique_ptr<llvm::orc::LLJIT> jit_;
+
+    // Optimization level for the pass pipeline
+    int opt_level_ = 2;
+
+    // Target CPU name ("native" = detect host CPU and features)
+    std::string target_cpu_ = "native";
+
+    // Persistent object cache shared across JIT instances
+    std::unique_ptr<AuroraObjectCache> object_cache_;
+    bool jit_cache_enabled_ = true;
+
+    // Compile lazily per function (LLLazyJIT) instead of whole-module
+    bool lazy_jit_ = false;
+
+    // Profile-guided JIT state: profile file of the current program and
+    // the functions carrying entry counters in this run
+    bool pgo_jit_ = false;
+    std::string profile_path_;
+    std::vector<std::string> profiled_functions_;
+
+    // Strip redundant refcount traffic before the main pipeline
+    bool arc_opt_enabled_ = true;
     
     // Main function return type (saved before JIT initialization)
     enum class MainReturnType { Int, Double, Void, Unknown };
     MainReturnType main_return_type_ = MainReturnType::Unknown;
     
-    std::vector<std::shared_ptr<Type>> function_return_stack_;
+    std::vector<Type*> function_return_stack_;
 };
 
 // Global instance
 CodeGenContext& getGlobalContext();
 
+// Lowers the built-in methods on array values (append/reserve/
+// shrinkToFit/size); implemented in ArrayCodeGen.cpp, dispatched to
+// from MemberCallExpr::codegen
+llvm::Value* codegenArrayMemberCall(MemberCallExpr& call);
+
 } // namespace aurora
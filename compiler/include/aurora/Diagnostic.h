@@ -1,6 +1,8 @@
 #pragma once
 
+#include <mutex>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace aurora {
@@ -63,11 +65,19 @@ private:
 };
 
 /// Diagnostic engine for collecting and reporting errors
+///
+/// Recording and rendering are separate: report() stores the compact
+/// record (level, code, message, location) and by default renders it to
+/// stderr immediately, which is what the CLI wants. Consumers that
+/// produce many diagnostics nobody reads on stderr - the LSP re-analyzes
+/// on every keystroke and serializes diagnostics as JSON instead - turn
+/// on deferred rendering, read the records through getDiagnosticsSince,
+/// and only pay console formatting if renderAll() is ever called.
 class DiagnosticEngine {
 public:
-    DiagnosticEngine(bool debug_mode = false) 
+    DiagnosticEngine(bool debug_mode = false)
         : debug_mode_(debug_mode), use_colors_(false), error_count_(0), warning_count_(0) {}
-    
+
     // Report diagnostics
     void report(const Diagnostic& diag);
     
@@ -78,9 +88,22 @@ public:
                        const SourceLocation& loc);
     void reportNote(const std::string& message, const SourceLocation& loc);
     
-    // Set source code for better error display
-    void setSourceCode(const std::string& source) { source_code_ = source; }
+    // Set source code for better error display; indexes line starts once
+    // so snippet rendering never re-splits the source per diagnostic
+    void setSourceCode(std::string_view source);
     void setFilename(const std::string& filename) { current_filename_ = filename; }
+
+    // Deferred rendering: report() only records, nothing is written to
+    // stderr until renderAll() (the LSP never calls it - diagnostics go
+    // out as JSON instead)
+    void setDeferredRendering(bool enable) { deferred_ = enable; }
+    bool deferredRendering() const { return deferred_; }
+    void renderAll();
+
+    // Access recorded diagnostics (for serialization); 'since' is a
+    // count previously returned by getDiagnosticCount
+    size_t getDiagnosticCount() const;
+    std::vector<Diagnostic> getDiagnosticsSince(size_t since) const;
     
     // Query state
     bool hasErrors() const { return error_count_ > 0; }
@@ -100,17 +123,24 @@ public:
     
     // Clear all diagnostics
     void clear() {
+        std::lock_guard<std::mutex> lock(mutex_);
         diagnostics_.clear();
         error_count_ = 0;
         warning_count_ = 0;
+        rendered_count_ = 0;
     }
-    
+
 private:
+    // Protects the diagnostic list when modules are parsed on worker threads
+    mutable std::mutex mutex_;
     bool debug_mode_;
     bool use_colors_;
+    bool deferred_ = false;
     size_t error_count_;
     size_t warning_count_;
+    size_t rendered_count_ = 0;  // diagnostics already written to stderr
     std::string source_code_;
+    std::vector<size_t> line_offsets_;  // byte offset of each line start
     std::string current_filename_;
     std::vector<Diagnostic> diagnostics_;
     
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "aurora/AST.h"
+#include <memory>
+#include <set>
+#include <vector>
+
+namespace aurora {
+
+/// Escape analysis over a function body.
+///
+/// Finds `new` expressions whose objects provably never outlive the
+/// function, so NewExpr lowering can place them in an entry-block
+/// alloca instead of calling malloc. A candidate is a variable bound
+/// directly to a `new` expression; it stays stack-allocatable as long
+/// as every use is a field access, a rebinding of the variable itself,
+/// or a devirtualized method call on a class none of whose methods let
+/// `this` escape. Returning the variable, passing it as an argument,
+/// storing it in another variable, field, or array, or anything the
+/// walk cannot classify marks it escaping and keeps the heap path.
+std::set<const NewExpr*> findStackAllocatableNews(
+    const std::vector<std::unique_ptr<Stmt>>& body);
+
+} // namespace aurora
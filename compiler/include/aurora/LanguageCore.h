@@ -2,6 +2,7 @@
 
 #include "aurora/Lexer.h"
 #include "aurora/Parser.h"
+#include "aurora/TokenStream.h"
 #include "aurora/AST.h"
 #include "aurora/Type.h"
 #include "aurora/Diagnostic.h"
@@ -12,6 +13,8 @@
 
 namespace aurora {
 
+class SymbolIndex;
+
 /// Symbol information for IDE features
 struct SymbolInfo {
     std::string name;
@@ -85,8 +88,9 @@ public:
     LanguageCore();
     ~LanguageCore();
     
-    // Source management
-    void setSource(const std::string& filename, const std::string& source);
+    // Source management (the source is taken by value so callers can
+    // move large documents in without a copy)
+    void setSource(const std::string& filename, std::string source);
     void clearSource(const std::string& filename);
     
     // Analysis
@@ -96,6 +100,12 @@ public:
     // Symbol indexing
     std::vector<SymbolInfo> getSymbols(const std::string& filename) const;
     std::vector<SymbolInfo> getWorkspaceSymbols(const std::string& query) const;
+
+    // Persistent workspace index: load restores symbols saved by a previous
+    // session so workspace/symbol works before files are re-analyzed;
+    // analyze() keeps the index current, save persists it (LSP shutdown)
+    size_t loadWorkspaceIndex(const std::string& workspace_root);
+    bool saveWorkspaceIndex();
     
     // Navigation
     HoverInfo getHover(const std::string& filename, size_t line, size_t column) const;
@@ -117,29 +127,62 @@ public:
                             size_t endLine, size_t endCol) const;
     
 private:
-    struct FileData {
-        std::string source;
-        std::unique_ptr<Lexer> lexer;
+    /// One top-level declaration (or run of declarations) parsed in
+    /// isolation. Re-analysis matches segments of the edited source against
+    /// cached segments by content, so an edit inside one function re-parses
+    /// only that function; everything else is reused with an updated line
+    /// offset. Node locations are segment-relative and shifted by
+    /// start_line - 1 when symbols are indexed.
+    struct Segment {
+        // Arena owning the AST below; declared first so it is destroyed
+        // last (after the node-owning containers)
+        std::unique_ptr<ASTArena> arena;
+        std::string text;       // exact source slice for this declaration
+        size_t start_line = 1;  // 1-based line where the slice begins
         std::vector<std::unique_ptr<Function>> functions;
         std::vector<std::unique_ptr<ClassDecl>> classes;
         std::vector<std::unique_ptr<ImportDecl>> imports;
         std::unique_ptr<PackageDecl> package;
+        bool ok = true;
+        // Parser diagnostics captured for this segment, already shifted
+        // to whole-file line numbers (only failed segments have any)
+        std::vector<Diagnostic> diagnostics;
+    };
+
+    struct FileData {
+        std::string source;
+        // Whole-file token array, rebuilt whenever the source changes; the
+        // segment scanner, whole-file parses and position queries all share
+        // it instead of re-lexing the buffer (token values view `source`)
+        std::unique_ptr<TokenStream> tokens;
+        std::vector<std::unique_ptr<Segment>> segments;
         std::vector<Diagnostic> diagnostics;
         std::vector<SymbolInfo> symbols;
     };
-    
+
     std::map<std::string, FileData> files_;
-    
+
+    // Owned by pointer so the header only needs a forward declaration
+    // (SymbolIndex.h includes this header for SymbolInfo)
+    std::unique_ptr<SymbolIndex> symbol_index_;
+
     // Helper methods
+    static std::unique_ptr<Segment> parseSegment(std::string text, size_t start_line,
+                                                 const TokenStream* tokens = nullptr);
+    static void captureSegmentDiagnostics(Segment& segment,
+                                          const std::string& filename,
+                                          size_t diag_base);
     void indexSymbols(const std::string& filename, FileData& data);
-    SymbolInfo* findSymbolAt(const std::string& filename, 
+    SymbolInfo* findSymbolAt(const std::string& filename,
                              size_t line, size_t column) const;
     void collectFunctionSymbols(const std::string& filename,
-                                const Function* func, 
+                                const Function* func,
                                 const std::string& container,
+                                size_t line_offset,
                                 std::vector<SymbolInfo>& symbols);
     void collectClassSymbols(const std::string& filename,
                             const ClassDecl* cls,
+                            size_t line_offset,
                             std::vector<SymbolInfo>& symbols);
     std::vector<CompletionItem> getKeywordCompletions() const;
     std::vector<CompletionItem> getContextCompletions(
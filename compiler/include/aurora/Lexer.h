@@ -1,6 +1,8 @@
 #pragma once
 
+#include <deque>
 #include <string>
+#include <string_view>
 
 namespace aurora {
 
@@ -105,23 +107,31 @@ enum class TokenType {
 };
 
 /// Token structure
+/// The value is a view into memory owned by the Lexer (the source buffer,
+/// or the escape storage for string literals) - tokens must not outlive
+/// the Lexer that produced them.
 struct Token {
     TokenType type;
-    std::string value;
+    std::string_view value;
     size_t line;
     size_t column;
-    
-    Token(TokenType t, std::string v, size_t l, size_t c)
-        : type(t), value(std::move(v)), line(l), column(c) {}
-    
+
+    Token(TokenType t, std::string_view v, size_t l, size_t c)
+        : type(t), value(v), line(l), column(c) {}
+
     std::string toString() const;
 };
 
 /// Lexer - Tokenizes source code
 class Lexer {
 public:
+    /// Take ownership of the source text
     explicit Lexer(std::string source);
-    
+
+    /// Tokenize externally-owned text (e.g. a mapped SourceBuffer) without
+    /// copying; the backing memory must outlive the Lexer and its tokens
+    explicit Lexer(std::string_view source);
+
     /// Get next token
     Token nextToken();
     
@@ -133,19 +143,25 @@ public:
     size_t getColumn() const { return column; }
 
 private:
-    std::string source;
+    std::string owned_source_;      // backing storage for the owning constructor
+    std::string_view source;        // the text being tokenized
     size_t pos;
     size_t line;
     size_t column;
+
+    // Backing storage for string literals containing escapes; a deque so
+    // already-handed-out views stay valid as new literals are added
+    std::deque<std::string> string_storage_;
     
     // Helper methods
     char current() const;
     char peek(size_t offset = 1) const;
     void advance();
+    void advanceBy(size_t count);
     void skipWhitespace();
     void skipComment();
     
-    Token makeToken(TokenType type, std::string value);
+    Token makeToken(TokenType type, std::string_view value);
     Token readIdentifierOrKeyword();
     Token readNumber();
     Token readString();
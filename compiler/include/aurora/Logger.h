@@ -1,10 +1,23 @@
 #pragma once
 
 #include <string>
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace aurora {
 
+/// Number of global operator new calls since process start (see Logger.cpp)
+uint64_t totalAllocationCount();
+
 /// Log levels for different types of messages
 enum class LogLevel {
     Trace,      // Very detailed information, typically only for diagnosis
@@ -25,7 +38,26 @@ struct LoggerConfig {
     bool compact_mode = false;  // Compact output for CI/CD
 };
 
+/// Metrics collected for one compiler phase when --time-report is active
+struct PhaseMetrics {
+    std::string name;
+    double wall_ms = 0.0;
+    long peak_rss_kb = 0;      // process high-water mark sampled at phase end
+    uint64_t allocations = 0;  // operator new calls during the phase
+    bool success = true;
+};
+
 /// Centralized logging system for AuroraLang compiler
+///
+/// Trace/debug/info records are asynchronous: the calling thread only
+/// captures the message and a timestamp into a bounded lock-free ring
+/// buffer; timestamp formatting, coloring, and stream writes happen on a
+/// background flush thread, so liberally-instrumented hot paths (module
+/// loading runs on worker threads) never serialize on I/O. Warnings and
+/// errors are written through synchronously after draining the ring, so
+/// they stay ordered with diagnostics on stderr. When the ring is full,
+/// filtered-priority records are dropped (and counted) rather than
+/// blocking the compiler.
 class Logger {
 public:
     static Logger& instance();
@@ -47,10 +79,46 @@ public:
     void warning(const std::string& message, const std::string& component = "");
     void error(const std::string& message, const std::string& component = "");
     void fatal(const std::string& message, const std::string& component = "");
-    
+
+    // Deferred-formatting variants: the callable builds the message and
+    // only runs when the level is enabled, so hot paths don't pay string
+    // concatenation for records that would be filtered
+    template <typename F,
+              typename std::enable_if<std::is_invocable<F>::value, int>::type = 0>
+    void trace(F&& make_message, const std::string& component = "") {
+        if (isEnabled(LogLevel::Trace)) trace(std::string(make_message()), component);
+    }
+    template <typename F,
+              typename std::enable_if<std::is_invocable<F>::value, int>::type = 0>
+    void debug(F&& make_message, const std::string& component = "") {
+        if (isEnabled(LogLevel::Debug)) debug(std::string(make_message()), component);
+    }
+    template <typename F,
+              typename std::enable_if<std::is_invocable<F>::value, int>::type = 0>
+    void info(F&& make_message, const std::string& component = "") {
+        if (isEnabled(LogLevel::Info)) info(std::string(make_message()), component);
+    }
+
+    /// Block until every queued record has been written (end-of-run
+    /// reports and process exit call this to keep output ordered)
+    void flush();
+
+    /// Records dropped because the ring buffer was full
+    uint64_t droppedRecordCount() const {
+        return dropped_records_.load(std::memory_order_relaxed);
+    }
+
     // Specialized logging for compiler phases
     void phaseStart(const std::string& phase_name);
     void phaseEnd(const std::string& phase_name, bool success = true);
+
+    // Phase metrics (--time-report): every phaseStart/phaseEnd pair also
+    // records wall time, peak RSS, and allocation count while enabled
+    void enablePhaseMetrics() { collect_metrics_ = true; }
+    bool phaseMetricsEnabled() const { return collect_metrics_; }
+    const std::vector<PhaseMetrics>& getPhaseMetrics() const { return phase_metrics_; }
+    void printPhaseReport();
+    void writePhaseReportJson(std::ostream& out);
     
     // Performance tracking
     class Timer {
@@ -76,12 +144,69 @@ public:
     
 private:
     Logger() = default;
+    ~Logger();
     LoggerConfig config_;
-    
+
+    // One captured log call; formatting is deferred to the flush thread.
+    // Raw records (phase banners, structured dumps) are written verbatim.
+    struct LogRecord {
+        LogLevel level = LogLevel::Debug;
+        bool raw = false;
+        std::string message;
+        std::string component;
+        std::chrono::system_clock::time_point time;
+    };
+
+    // Bounded MPMC ring (Vyukov sequence scheme, consumed by one flush
+    // thread); power-of-two capacity
+    static constexpr size_t kRingSize = 1024;
+    struct Cell {
+        std::atomic<size_t> sequence;
+        LogRecord record;
+    };
+    std::unique_ptr<Cell[]> ring_;
+    std::atomic<size_t> enqueue_pos_{0};
+    std::atomic<size_t> dequeue_pos_{0};
+    std::atomic<uint64_t> dropped_records_{0};
+
+    // Flush thread, started lazily on the first async record
+    std::once_flag backend_once_;
+    std::thread flush_thread_;
+    std::atomic<bool> backend_stop_{false};
+    std::condition_variable queue_cv_;
+    std::mutex queue_cv_mutex_;
+
+    // Held while a record is being formatted and written, by the flush
+    // thread and by synchronous warning/error write-through
+    std::mutex io_mutex_;
+
+    void startBackend();
+    void flushLoop();
+    bool enqueue(LogRecord&& record);
+    bool tryDequeue(LogRecord& record);
+    bool queueEmpty() const;
+    void writeRecord(const LogRecord& record);
+
+    // Phase metrics state; the stack tolerates nested phases (per-module
+    // loading runs inside the top-level "Module loading" phase)
+    struct ActivePhase {
+        std::string name;
+        std::chrono::time_point<std::chrono::steady_clock> start;
+        uint64_t allocations_at_start;
+    };
+    bool collect_metrics_ = false;
+    std::vector<ActivePhase> phase_stack_;
+    std::vector<PhaseMetrics> phase_metrics_;
+
+    // Guards the phase metrics state when compiler phases run on worker
+    // threads (record writes are serialized by io_mutex_ instead)
+    std::mutex log_mutex_;
+
     void log(LogLevel level, const std::string& message, const std::string& component);
+    void logRaw(LogLevel level, std::string text);
     std::string getLevelString(LogLevel level) const;
     std::string getLevelColor(LogLevel level) const;
-    std::string getCurrentTime() const;
+    std::string formatTime(std::chrono::system_clock::time_point time) const;
 };
 
 // Convenience macros for logging
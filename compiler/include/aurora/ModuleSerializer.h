@@ -0,0 +1,77 @@
+#pragma once
+
+#include "aurora/Type.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace aurora {
+
+class Function;
+class ClassDecl;
+class ImportDecl;
+
+/// Declaration-level summary of a module as stored in a precompiled
+/// .aurm file: imports, function prototypes, and class layouts, with
+/// types encoded as mangled names. Bodies are not serialized; they are
+/// materialized from the .aur source when the module is compiled.
+struct ModuleInterface {
+    struct FunctionSig {
+        std::string name;
+        std::string returnType;                                // mangled
+        std::vector<std::pair<std::string, std::string>> params; // name, mangled type
+    };
+
+    struct FieldSig {
+        std::string name;
+        std::string type;  // mangled
+        bool isPublic;
+    };
+
+    struct MethodSig {
+        std::string name;
+        std::string returnType;                                // mangled
+        std::vector<std::pair<std::string, std::string>> params; // name, mangled type
+        bool isPublic;
+        bool isStatic;
+        bool isConstructor;
+    };
+
+    struct ClassSig {
+        std::string name;
+        bool isSingleton;
+        std::vector<FieldSig> fields;
+        std::vector<MethodSig> methods;
+    };
+
+    std::vector<std::string> imports;
+    std::vector<FunctionSig> functions;
+    std::vector<ClassSig> classes;
+};
+
+/// Reads and writes precompiled module interfaces (.aurm files).
+/// A cache file sits next to its .aur source and records the source
+/// size and modification time; stale or malformed files are ignored.
+class ModuleSerializer {
+public:
+    /// Cache file path for a module source (foo.aur -> foo.aurm)
+    static std::string cachePathFor(const std::string& sourcePath);
+
+    /// Serialize the declarations of a parsed module. Best-effort:
+    /// returns false (without reporting an error) if the file cannot
+    /// be written, e.g. into a read-only stdlib directory.
+    static bool write(const std::string& sourcePath,
+                      const std::vector<std::unique_ptr<Function>>& functions,
+                      const std::vector<std::unique_ptr<ClassDecl>>& classes,
+                      const std::vector<std::unique_ptr<ImportDecl>>& imports);
+
+    /// Load the cached interface for a module source. Returns false if
+    /// no cache exists or it does not match the current source file.
+    static bool read(const std::string& sourcePath, ModuleInterface& out);
+
+    /// Reconstruct a Type from its mangled name (see Type::getMangledName).
+    /// Returns nullptr if the encoding is not recognized.
+    static Type* typeFromMangledName(const std::string& mangled);
+};
+
+} // namespace aurora
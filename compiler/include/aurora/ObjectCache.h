@@ -0,0 +1,39 @@
+#pragma once
+
+#include <llvm/ExecutionEngine/ObjectCache.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <memory>
+#include <string>
+
+namespace aurora {
+
+/// Persistent JIT object cache
+/// Compiled machine code is stored on disk keyed by a hash of the module
+/// IR plus the LLVM version and cache format, so byte-identical modules
+/// (unchanged user code, stdlib sources) skip instruction selection on
+/// later runs and only pay relocation. Cache location is
+/// $AURORA_CACHE_DIR if set, otherwise ~/.cache/aurora.
+class AuroraObjectCache : public llvm::ObjectCache {
+public:
+    AuroraObjectCache();
+
+    /// Called by the JIT after compiling a module; persists the object
+    void notifyObjectCompiled(const llvm::Module* module,
+                              llvm::MemoryBufferRef obj) override;
+
+    /// Called by the JIT before compiling a module; returns the cached
+    /// object on a hit, or nullptr to trigger a normal compile
+    std::unique_ptr<llvm::MemoryBuffer> getObject(const llvm::Module* module) override;
+
+    /// False if no usable cache directory could be found/created
+    bool isEnabled() const { return enabled_; }
+    const std::string& getCacheDir() const { return cache_dir_; }
+
+private:
+    std::string cacheFileFor(const llvm::Module* module);
+
+    std::string cache_dir_;
+    bool enabled_ = false;
+};
+
+} // namespace aurora
@@ -2,6 +2,8 @@
 
 #include "aurora/AST.h"
 #include "aurora/Lexer.h"
+#include "aurora/SymbolTable.h"
+#include "aurora/TokenStream.h"
 #include <memory>
 #include <vector>
 
@@ -11,7 +13,11 @@ namespace aurora {
 class Parser {
 public:
     explicit Parser(Lexer& lexer);
-    
+
+    /// Parse from a pre-lexed token stream (e.g. LanguageCore's per-file
+    /// cache); the stream must outlive the parser
+    explicit Parser(const TokenStream& tokens);
+
     /// Parse the entire program (returns list of functions and classes)
     std::vector<std::unique_ptr<Function>> parseProgram();
     std::vector<std::unique_ptr<ClassDecl>>& getClasses() { return classes_; }
@@ -20,7 +26,12 @@ public:
     const std::string& getCurrentPackageName() const { return currentPackageName_; }
     
 private:
-    Lexer& lexer_;
+    // Token source: either a caller-owned pre-lexed stream or one drained
+    // from the Lexer& constructor. pos_ indexes the token after
+    // current_token_, so lookahead and rewind are array accesses.
+    std::unique_ptr<TokenStream> owned_tokens_;
+    const TokenStream* tokens_;
+    size_t pos_ = 0;
     Token current_token_;
     std::vector<std::unique_ptr<ClassDecl>> classes_;
     std::vector<std::unique_ptr<ImportDecl>> imports_;
@@ -28,13 +39,19 @@ private:
     std::string currentPackageName_;  // Track current package for resolution
     
     // Symbol table for tracking variable types during parsing
-    std::map<std::string, std::shared_ptr<Type>> local_types_;
+    // (flat scoped storage, see SymbolTable.h)
+    FlatSymbolTable<Type*> local_types_;
     
     // Helper methods
     void advance();
     bool match(TokenType type);
     bool expect(TokenType type, const std::string& message);
     Token peek();
+    /// Token `distance` ahead of the current one, without consuming (O(1))
+    const Token& lookahead(size_t distance) const;
+    /// Save/restore the stream position for speculative parsing
+    size_t mark() const { return pos_; }
+    void rewindTo(size_t mark);
     
     // Parsing methods
     std::unique_ptr<Function> parseFunction();
@@ -47,6 +64,7 @@ private:
     std::unique_ptr<Stmt> parseReturnStatement();
     std::unique_ptr<Stmt> parseVarDecl();
     std::unique_ptr<Stmt> parseIfStatement();
+    std::unique_ptr<Stmt> parseMatchStatement();
     std::unique_ptr<Stmt> parseWhileStatement();
     std::unique_ptr<Stmt> parseForStatement();
     std::unique_ptr<Stmt> parseLoopStatement();
@@ -74,10 +92,10 @@ private:
     std::unique_ptr<Expr> parseCall(std::string callee);
     
     // Type parsing
-    std::shared_ptr<Type> parseType();
+    Type* parseType();
     
     // Type inference helpers
-    std::shared_ptr<Type> inferMethodReturnType(const std::shared_ptr<Type>& objType, 
+    Type* inferMethodReturnType(Type* objType, 
                                                  const std::string& methodName);
     
     // Error handling
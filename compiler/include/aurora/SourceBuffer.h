@@ -0,0 +1,43 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace aurora {
+
+/// Read-only view of a source file's contents.
+/// Files are memory-mapped where the platform supports it, so opening a
+/// source costs no copy at all; the Lexer and its tokens view the mapped
+/// pages directly. Falls back to a plain read when mapping fails (empty
+/// files, pipes, platforms without mmap). The buffer must outlive every
+/// Lexer and Token that views it.
+class SourceBuffer {
+public:
+    /// Open a file. Returns nullptr if the file cannot be read.
+    static std::unique_ptr<SourceBuffer> open(const std::string& path);
+
+    /// Wrap already-loaded contents (e.g. LSP document text)
+    static std::unique_ptr<SourceBuffer> fromString(std::string contents,
+                                                    std::string path = "<input>");
+
+    ~SourceBuffer();
+
+    SourceBuffer(const SourceBuffer&) = delete;
+    SourceBuffer& operator=(const SourceBuffer&) = delete;
+
+    std::string_view contents() const { return std::string_view(data_, size_); }
+    const std::string& path() const { return path_; }
+    size_t size() const { return size_; }
+
+private:
+    SourceBuffer() = default;
+
+    std::string path_;
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+    bool mapped_ = false;   // data_ points at mmap'd pages
+    std::string owned_;     // backing storage for the fallback paths
+};
+
+} // namespace aurora
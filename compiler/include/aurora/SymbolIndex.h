@@ -0,0 +1,69 @@
+#pragma once
+
+#include "aurora/LanguageCore.h"
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace aurora {
+
+/// Persistent workspace symbol index
+/// Symbols from every analyzed file are kept in a name-sorted query
+/// structure (binary-search prefix lookup with a case-insensitive
+/// subsequence fallback for fuzzy queries) and mirrored to one on-disk
+/// file per workspace, keyed by a content hash per source file. A
+/// restarted server loads the index and answers workspace/symbol
+/// queries immediately, before any file has been re-analyzed; entries
+/// are replaced as files are re-analyzed with a different hash. Index
+/// location follows the JIT object cache: $AURORA_CACHE_DIR if set,
+/// otherwise ~/.cache/aurora.
+class SymbolIndex {
+public:
+    SymbolIndex() = default;
+
+    /// Bind the index to a workspace and load any saved entries;
+    /// returns the number of symbols restored
+    size_t load(const std::string& workspace_root);
+
+    /// Persist the whole index to disk (write-then-rename)
+    bool save();
+
+    /// Replace one file's symbols after an analysis pass
+    void updateFile(const std::string& filename,
+                    const std::string& content_hash,
+                    const std::vector<SymbolInfo>& symbols);
+    void removeFile(const std::string& filename);
+
+    /// Content hash recorded for a file, or "" when the file is unknown
+    std::string hashFor(const std::string& filename) const;
+
+    /// Case-insensitive query: prefix matches rank first, subsequence
+    /// (fuzzy) matches fill the remainder; empty query returns everything
+    /// up to max_results
+    std::vector<SymbolInfo> query(const std::string& text,
+                                  size_t max_results = 200) const;
+
+    size_t symbolCount() const;
+
+    /// FNV-1a hash of a file's contents, as fixed-width hex
+    static std::string hashContent(const std::string& source);
+
+private:
+    struct FileEntry {
+        std::string hash;
+        std::vector<SymbolInfo> symbols;
+    };
+
+    void rebuildSortedView() const;
+    std::string indexPathFor(const std::string& workspace_root) const;
+
+    std::map<std::string, FileEntry> files_;
+    std::string index_path_;  // empty when persistence is unavailable
+
+    // Lowercased name -> symbol, sorted; rebuilt lazily after updates
+    mutable std::vector<std::pair<std::string, const SymbolInfo*>> sorted_;
+    mutable bool sorted_dirty_ = true;
+};
+
+} // namespace aurora
@@ -0,0 +1,187 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace aurora {
+
+/// Flat scoped symbol table
+/// Open-addressing hash storage (linear probing, power-of-two capacity)
+/// keyed by identifier text, replacing the std::map tables whose
+/// per-node allocations and full string comparisons dominated variable
+/// lookup in both parsing and lowering. Values are pointer-like: V{}
+/// means "not present".
+///
+/// Scopes are watermarks, not nested maps: enterScope() returns a mark,
+/// inserts and erases inside the scope append undo records, and
+/// exitScope(mark) replays them backwards - O(number of bindings made
+/// in the scope), with shadowed outer bindings restored in place.
+template <typename V>
+class FlatSymbolTable {
+public:
+    FlatSymbolTable() { rehash(kInitialCapacity); }
+
+    /// Value bound to `key`, or V{} when unbound
+    V lookup(const std::string& key) const {
+        const Slot& slot = slots_[findSlot(key)];
+        return slot.state == SlotState::Full ? slot.value : V{};
+    }
+
+    /// Bind or rebind `key`; shadowing inside a scope is undone on exit
+    void insert(const std::string& key, V value) {
+        journalFor(key);
+        rawInsert(key, value);
+    }
+
+    void erase(const std::string& key) {
+        journalFor(key);
+        rawErase(key);
+    }
+
+    void clear() {
+        slots_.assign(slots_.size(), Slot{});
+        size_ = 0;
+        tombstones_ = 0;
+        journal_.clear();
+        scope_depth_ = 0;
+    }
+
+    /// Open a scope; pass the returned mark to exitScope
+    size_t enterScope() {
+        scope_depth_++;
+        return journal_.size();
+    }
+
+    /// Drop every binding made since `mark`, restoring shadowed ones
+    void exitScope(size_t mark) {
+        while (journal_.size() > mark) {
+            UndoRecord& undo = journal_.back();
+            if (undo.had_previous) {
+                rawInsert(undo.key, undo.previous);
+            } else {
+                rawErase(undo.key);
+            }
+            journal_.pop_back();
+        }
+        if (scope_depth_ > 0) {
+            scope_depth_--;
+        }
+    }
+
+    size_t size() const { return size_; }
+
+private:
+    enum class SlotState : uint8_t { Empty, Full, Tombstone };
+
+    struct Slot {
+        std::string key;
+        V value{};
+        SlotState state = SlotState::Empty;
+    };
+
+    struct UndoRecord {
+        std::string key;
+        V previous{};
+        bool had_previous = false;
+    };
+
+    static constexpr size_t kInitialCapacity = 32;
+
+    std::vector<Slot> slots_;
+    size_t size_ = 0;
+    size_t tombstones_ = 0;
+    std::vector<UndoRecord> journal_;
+    size_t scope_depth_ = 0;
+
+    static uint64_t hash(const std::string& key) {
+        uint64_t h = 1469598103934665603ull;  // FNV-1a
+        for (unsigned char c : key) {
+            h = (h ^ c) * 1099511628211ull;
+        }
+        return h;
+    }
+
+    // Slot holding `key`, or the first insertable slot of its probe
+    // sequence (capacity is a power of two, so masking replaces modulo)
+    size_t findSlot(const std::string& key) const {
+        size_t mask = slots_.size() - 1;
+        size_t index = hash(key) & mask;
+        size_t first_free = slots_.size();
+        while (true) {
+            const Slot& slot = slots_[index];
+            if (slot.state == SlotState::Empty) {
+                return first_free != slots_.size() ? first_free : index;
+            }
+            if (slot.state == SlotState::Tombstone) {
+                if (first_free == slots_.size()) {
+                    first_free = index;
+                }
+            } else if (slot.key == key) {
+                return index;
+            }
+            index = (index + 1) & mask;
+        }
+    }
+
+    void journalFor(const std::string& key) {
+        if (scope_depth_ == 0) {
+            return;
+        }
+        const Slot& slot = slots_[findSlot(key)];
+        if (slot.state == SlotState::Full) {
+            journal_.push_back({key, slot.value, true});
+        } else {
+            journal_.push_back({key, V{}, false});
+        }
+    }
+
+    void rawInsert(const std::string& key, V value) {
+        // Tombstones count against the load factor so a churn-heavy
+        // table cannot fill up with dead slots and stall probing
+        if ((size_ + tombstones_ + 1) * 10 >= slots_.size() * 7) {
+            rehash(slots_.size() * 2);
+        }
+        Slot& slot = slots_[findSlot(key)];
+        if (slot.state != SlotState::Full) {
+            slot.key = key;
+            if (slot.state == SlotState::Tombstone) {
+                tombstones_--;
+            }
+            size_++;
+        }
+        slot.value = value;
+        slot.state = SlotState::Full;
+    }
+
+    void rawErase(const std::string& key) {
+        Slot& slot = slots_[findSlot(key)];
+        if (slot.state == SlotState::Full) {
+            slot.key.clear();
+            slot.value = V{};
+            slot.state = SlotState::Tombstone;
+            tombstones_++;
+            size_--;
+        }
+    }
+
+    void rehash(size_t new_capacity) {
+        std::vector<Slot> old = std::move(slots_);
+        slots_.assign(new_capacity, Slot{});
+        size_ = 0;
+        tombstones_ = 0;
+        for (Slot& slot : old) {
+            if (slot.state == SlotState::Full) {
+                Slot& target = slots_[findSlot(slot.key)];
+                target.key = std::move(slot.key);
+                target.value = slot.value;
+                target.state = SlotState::Full;
+                size_++;
+            }
+        }
+    }
+};
+
+} // namespace aurora
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "aurora/Lexer.h"
+#include <memory>
+#include <vector>
+
+namespace aurora {
+
+/// TokenStream - a source buffer lexed once into a flat token array.
+///
+/// The Parser used to pull tokens one at a time through Lexer::nextToken
+/// and the IDE layer re-lexed the same buffer for every position query; a
+/// TokenStream lexes once, gives the parser O(1) indexed lookahead and
+/// backtracking, and answers token-at-position queries by binary search
+/// (tokens are emitted in start-position order).
+///
+/// Token values are views into the backing source (and the Lexer's escape
+/// storage), so the stream must not outlive the buffer it was built from.
+class TokenStream {
+public:
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    /// Lex externally-owned text; the backing memory must outlive the stream
+    explicit TokenStream(std::string_view source);
+
+    /// Drain an existing lexer; the lexer must outlive the stream (it owns
+    /// the escape storage behind string-literal tokens)
+    explicit TokenStream(Lexer& lexer);
+
+    /// Number of tokens, including the trailing Eof
+    size_t size() const { return tokens_.size(); }
+
+    /// Token at index; out-of-range indices clamp to the trailing Eof
+    const Token& at(size_t index) const {
+        return tokens_[index < tokens_.size() ? index : tokens_.size() - 1];
+    }
+
+    /// Index of the token covering (line, column), or npos
+    size_t indexAt(size_t line, size_t column) const;
+
+    /// Token covering (line, column), or nullptr
+    const Token* tokenAt(size_t line, size_t column) const;
+
+private:
+    void drain(Lexer& lexer);
+
+    std::unique_ptr<Lexer> owned_lexer_;  // backing lexer for the view ctor
+    std::vector<Token> tokens_;           // always ends with an Eof token
+};
+
+} // namespace aurora
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 #include <map>
@@ -101,7 +102,7 @@ public:
 /// Optional type for null safety (Optional<T>)
 class OptionalType : public Type {
 public:
-    explicit OptionalType(std::shared_ptr<Type> inner) : innerType(std::move(inner)) {}
+    explicit OptionalType(Type* inner) : innerType(inner) {}
     
     Kind getKind() const override { return Kind::Optional; }
     std::string toString() const override;
@@ -110,17 +111,17 @@ public:
     std::string getMangledName() const override;
     bool equals(const Type* other) const override;
     
-    std::shared_ptr<Type> getInnerType() const { return innerType; }
+    Type* getInnerType() const { return innerType; }
 
 private:
-    std::shared_ptr<Type> innerType;
+    Type* innerType;
 };
 
 /// Function type
 class FunctionType : public Type {
 public:
-    FunctionType(std::shared_ptr<Type> ret, std::vector<std::shared_ptr<Type>> params)
-        : returnType(std::move(ret)), paramTypes(std::move(params)) {}
+    FunctionType(Type* ret, std::vector<Type*> params)
+        : returnType(ret), paramTypes(std::move(params)) {}
     
     Kind getKind() const override { return Kind::Function; }
     std::string toString() const override;
@@ -128,18 +129,18 @@ public:
     std::string getMangledName() const override;
     bool equals(const Type* other) const override;
     
-    std::shared_ptr<Type> getReturnType() const { return returnType; }
-    const std::vector<std::shared_ptr<Type>>& getParamTypes() const { return paramTypes; }
+    Type* getReturnType() const { return returnType; }
+    const std::vector<Type*>& getParamTypes() const { return paramTypes; }
 
 private:
-    std::shared_ptr<Type> returnType;
-    std::vector<std::shared_ptr<Type>> paramTypes;
+    Type* returnType;
+    std::vector<Type*> paramTypes;
 };
 
 /// Array type [T]
 class ArrayType : public Type {
 public:
-    explicit ArrayType(std::shared_ptr<Type> elem) : elementType(std::move(elem)) {}
+    explicit ArrayType(Type* elem) : elementType(elem) {}
     
     Kind getKind() const override { return Kind::Array; }
     std::string toString() const override;
@@ -147,10 +148,10 @@ public:
     std::string getMangledName() const override;
     bool equals(const Type* other) const override;
     
-    std::shared_ptr<Type> getElementType() const { return elementType; }
+    Type* getElementType() const { return elementType; }
 
 private:
-    std::shared_ptr<Type> elementType;
+    Type* elementType;
 };
 
 /// Class type (forward declaration of ClassDecl for circular dependency)
@@ -176,32 +177,42 @@ private:
     ClassDecl* decl;  // Pointer to the class declaration
 };
 
-/// Type registry and factory
+/// Type registry and interner.
+/// Owns every Type it hands out for the lifetime of the process and
+/// hash-conses composite types, so two structurally equal types are the
+/// same object and type equality is a pointer comparison.
 class TypeRegistry {
 public:
     static TypeRegistry& instance();
     
-    std::shared_ptr<VoidType> getVoidType();
-    std::shared_ptr<IntType> getIntType();
-    std::shared_ptr<DoubleType> getDoubleType();
-    std::shared_ptr<BoolType> getBoolType();
-    std::shared_ptr<StringType> getStringType();
-    std::shared_ptr<OptionalType> getOptionalType(std::shared_ptr<Type> inner);
-    std::shared_ptr<FunctionType> getFunctionType(std::shared_ptr<Type> ret, 
-                                                   std::vector<std::shared_ptr<Type>> params);
-    std::shared_ptr<ClassType> getClassType(const std::string& name);
+    VoidType* getVoidType() { return &voidType; }
+    IntType* getIntType() { return &intType; }
+    DoubleType* getDoubleType() { return &doubleType; }
+    BoolType* getBoolType() { return &boolType; }
+    StringType* getStringType() { return &stringType; }
+    OptionalType* getOptionalType(Type* inner);
+    FunctionType* getFunctionType(Type* ret, std::vector<Type*> params);
+    ClassType* getClassType(const std::string& name);
     bool hasClassType(const std::string& name) const;
-    std::shared_ptr<ArrayType> getArrayType(std::shared_ptr<Type> elementType);
+    ArrayType* getArrayType(Type* elementType);
 
 private:
     TypeRegistry() = default;
-    
-    std::shared_ptr<VoidType> voidType;
-    std::shared_ptr<IntType> intType;
-    std::shared_ptr<DoubleType> doubleType;
-    std::shared_ptr<BoolType> boolType;
-    std::shared_ptr<StringType> stringType;
-    std::map<std::string, std::shared_ptr<ClassType>> classTypes;
+
+    // Guards the interning maps; the registry is shared by parser
+    // threads during parallel module loading. The primitive singletons
+    // are plain members and need no lock.
+    mutable std::mutex mutex_;
+
+    VoidType voidType;
+    IntType intType;
+    DoubleType doubleType;
+    BoolType boolType;
+    StringType stringType;
+    std::map<Type*, std::unique_ptr<OptionalType>> optionalTypes;
+    std::map<Type*, std::unique_ptr<ArrayType>> arrayTypes;
+    std::map<std::string, std::unique_ptr<FunctionType>> functionTypes;
+    std::map<std::string, std::unique_ptr<ClassType>> classTypes;
 };
 
 } // namespace aurora
@@ -13,17 +13,17 @@ namespace aurora {
 
 // ImportDecl::load() is implemented in ModuleLoader.cpp
 
-std::shared_ptr<Type> BinaryExpr::getType() const {
+Type* BinaryExpr::getType() const {
     auto& registry = TypeRegistry::instance();
     
     auto leftType = left ? left->getType() : nullptr;
     auto rightType = right ? right->getType() : nullptr;
     
-    auto isDouble = [](const std::shared_ptr<Type>& type) {
+    auto isDouble = [](Type* type) {
         return type && type->isDouble();
     };
     
-    auto isInt = [](const std::shared_ptr<Type>& type) {
+    auto isInt = [](Type* type) {
         return type && type->isInt();
     };
     
@@ -62,7 +62,7 @@ std::shared_ptr<Type> BinaryExpr::getType() const {
     }
 }
 
-std::shared_ptr<Type> UnaryExpr::getType() const {
+Type* UnaryExpr::getType() const {
     auto& registry = TypeRegistry::instance();
     auto operandType = expr ? expr->getType() : nullptr;
     
@@ -0,0 +1,108 @@
+#include "aurora/ASTArena.h"
+#include <cstdlib>
+#include <cstdint>
+#include <new>
+
+namespace aurora {
+
+// First block is 64KB; subsequent blocks double up to 1MB so large
+// generated modules stay in a handful of mappings.
+static constexpr size_t kInitialBlockSize = 64 * 1024;
+static constexpr size_t kMaxBlockSize = 1024 * 1024;
+
+// Every allocation is prefixed with one max-aligned word tagging its
+// origin (arena vs heap) so ASTAllocated::operator delete can tell them
+// apart without any per-pointer lookup.
+static constexpr size_t kPrefixSize = alignof(std::max_align_t);
+static constexpr uint64_t kArenaTag = 0xA57A;
+static constexpr uint64_t kHeapTag = 0x4EA9;
+
+static thread_local ASTArena* current_arena = nullptr;
+
+ASTArena::ASTArena()
+    : next_block_size_(kInitialBlockSize), bytes_allocated_(0) {}
+
+ASTArena::~ASTArena() {
+    // One-shot teardown: node destructors have already run via the
+    // owning unique_ptrs; here we just drop the backing memory.
+    for (auto& block : blocks_) {
+        std::free(block.data);
+    }
+}
+
+void ASTArena::addBlock(size_t min_size) {
+    size_t size = next_block_size_;
+    while (size < min_size) {
+        size *= 2;
+    }
+    if (next_block_size_ < kMaxBlockSize) {
+        next_block_size_ *= 2;
+    }
+
+    char* data = static_cast<char*>(std::malloc(size));
+    if (!data) {
+        throw std::bad_alloc();
+    }
+    blocks_.push_back({data, size, 0});
+}
+
+void* ASTArena::allocate(size_t size) {
+    // Keep every node max-aligned; node sizes are small so the rounding
+    // waste is negligible compared to malloc headers.
+    size = (size + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+
+    if (blocks_.empty() || blocks_.back().used + size > blocks_.back().size) {
+        addBlock(size);
+    }
+
+    Block& block = blocks_.back();
+    void* ptr = block.data + block.used;
+    block.used += size;
+    bytes_allocated_ += size;
+    return ptr;
+}
+
+ASTArena* ASTArena::current() {
+    return current_arena;
+}
+
+ASTArenaScope::ASTArenaScope(ASTArena& arena)
+    : previous_(current_arena) {
+    current_arena = &arena;
+}
+
+ASTArenaScope::~ASTArenaScope() {
+    current_arena = previous_;
+}
+
+void* ASTAllocated::operator new(size_t size) {
+    ASTArena* arena = ASTArena::current();
+    char* raw;
+    uint64_t tag;
+
+    if (arena) {
+        raw = static_cast<char*>(arena->allocate(size + kPrefixSize));
+        tag = kArenaTag;
+    } else {
+        raw = static_cast<char*>(std::malloc(size + kPrefixSize));
+        if (!raw) {
+            throw std::bad_alloc();
+        }
+        tag = kHeapTag;
+    }
+
+    *reinterpret_cast<uint64_t*>(raw) = tag;
+    return raw + kPrefixSize;
+}
+
+void ASTAllocated::operator delete(void* ptr) {
+    if (!ptr) return;
+
+    char* raw = static_cast<char*>(ptr) - kPrefixSize;
+    if (*reinterpret_cast<uint64_t*>(raw) == kHeapTag) {
+        std::free(raw);
+    }
+    // Arena-owned storage is reclaimed in bulk by ~ASTArena().
+}
+
+} // namespace aurora
@@ -3,18 +3,33 @@
 #include "aurora/Parser.h"
 #include "aurora/CodeGen.h"
 #include "aurora/Logger.h"
+#include "aurora/ModuleSerializer.h"
+#include "aurora/SourceBuffer.h"
 #include "aurora/Utils.h"
 #include <fstream>
 #include <sstream>
 #include <filesystem>
+#include <future>
+#include <mutex>
 #include <set>
+#include <map>
 #include <algorithm>
 #include <cstdlib>
 
 namespace aurora {
 
 // Keep track of already loaded modules to prevent circular imports
+// (guarded by moduleRegistryMutex: modules are parsed on worker threads)
 static std::set<std::string> loadedModules;
+// Resolved .aur files behind the loaded modules, for tools (watch mode)
+// that need to know which files this compilation depends on
+static std::set<std::string> loadedModuleFiles;
+static std::mutex moduleRegistryMutex;
+
+std::vector<std::string> getLoadedModuleFiles() {
+    std::lock_guard<std::mutex> lock(moduleRegistryMutex);
+    return std::vector<std::string>(loadedModuleFiles.begin(), loadedModuleFiles.end());
+}
 
 // Global registry for package source directories
 static std::vector<std::string> packageSearchPaths;
@@ -95,38 +110,46 @@ std::string PackageDecl::toPath() const {
     return path;
 }
 
-bool ImportDecl::load(const std::string& currentFile, const std::string& currentPackage) {
+/// One fully parsed (but not yet code-generated) module.
+/// The arena is declared first so it is destroyed last, after the
+/// node-owning containers below it.
+struct ParsedModule {
+    std::unique_ptr<ASTArena> arena;
+    std::string importPath;     // as written in the import statement
+    std::string resolvedPath;   // file that was parsed
+    std::vector<std::unique_ptr<Function>> functions;
+    std::vector<std::unique_ptr<ClassDecl>> classes;
+    std::vector<std::unique_ptr<ImportDecl>> imports;
+    std::string package;
+    bool ok = false;
+    bool writeCache = false;  // no fresh .aurm existed; write one after parsing
+};
+
+/// Resolve an import path to an existing .aur file (empty on failure)
+static std::string resolveModuleFile(const std::string& modulePath,
+                                     const std::string& currentFile) {
     auto& logger = Logger::instance();
-    
-    // Initialize module system if not already done
-    if (!moduleSystemInitialized) {
-        initializeModuleSystem();
-    }
-    
-    // Check if module is already loaded
-    if (loadedModules.count(modulePath) > 0) {
-        logger.debug("Module already loaded: " + modulePath, "Modules");
-        return true;
-    }
-    
+
     // Resolve module path (.aur file)
     std::string filePath;
     bool isPackageImport = false;
-    
+
     // Determine if this is a package-style import (contains dots but no slashes)
-    if (modulePath.find('.') != std::string::npos && 
-        modulePath.find('/') == std::string::npos && 
+    if (modulePath.find('.') != std::string::npos &&
+        modulePath.find('/') == std::string::npos &&
         modulePath.find('\\') == std::string::npos) {
         // Package-style import: com.example.MyClass
         isPackageImport = true;
-        
+
         // Convert package path to file path
         std::string packagePath = modulePath;
         std::replace(packagePath.begin(), packagePath.end(), '.', '/');
         filePath = packagePath + ".aur";
-        
-        logger.debug("Package import detected: " + modulePath + " -> " + filePath, "Modules");
-    } 
+
+        logger.debug([&] {
+            return "Package import detected: " + modulePath + " -> " + filePath;
+        }, "Modules");
+    }
     // If path contains '/', treat as relative path
     else if (modulePath.find('/') != std::string::npos || modulePath.find('\\') != std::string::npos) {
         filePath = modulePath;
@@ -138,15 +161,15 @@ bool ImportDecl::load(const std::string& currentFile, const std::string& current
         // Simple name - look in current directory or package-relative
         filePath = modulePath + ".aur";
     }
-    
+
     // Try to resolve the file path
     std::string resolvedPath;
-    
+
     // Try different resolution strategies
     if (isPackageImport) {
         // For package imports, search in package search paths
         bool found = false;
-        
+
         // First try relative to current file (for test organization)
         if (!currentFile.empty()) {
             std::filesystem::path currentPath(currentFile);
@@ -157,7 +180,7 @@ bool ImportDecl::load(const std::string& currentFile, const std::string& current
                 logger.debug("Found package file relative to current: " + resolvedPath, "Modules");
             }
         }
-        
+
         // Then try package search paths
         if (!found) {
             for (const auto& searchPath : packageSearchPaths) {
@@ -170,17 +193,17 @@ bool ImportDecl::load(const std::string& currentFile, const std::string& current
                 }
             }
         }
-        
+
         // Finally try current directory
         if (!found && std::filesystem::exists(filePath)) {
             resolvedPath = filePath;
             found = true;
             logger.debug("Found package file in current dir: " + resolvedPath, "Modules");
         }
-        
+
         if (!found) {
             logger.error("Package file not found: " + modulePath + " (searched in package paths and relative to " + currentFile + ")");
-            return false;
+            return "";
         }
     } else {
         // For regular imports, try relative to current file first
@@ -190,87 +213,279 @@ bool ImportDecl::load(const std::string& currentFile, const std::string& current
             std::filesystem::path moduleFilePath(filePath);
             resolvedPath = (currentPath.parent_path() / moduleFilePath).string();
         }
-        
+
         // Check if file exists
         if (!std::filesystem::exists(resolvedPath)) {
             logger.error("Module file not found: " + resolvedPath + " (imported from: " + currentFile + ")");
-            return false;
+            return "";
         }
     }
-    
-    filePath = resolvedPath;
-    
-    // Load file contents
-    std::ifstream file(filePath);
-    if (!file) {
-        logger.error("Cannot open module file: " + filePath);
-        return false;
+
+    return resolvedPath;
+}
+
+/// Read and parse one module; safe to run on a worker thread
+/// (logger/diagnostics/type registry are internally synchronized)
+static void parseModuleFile(ParsedModule& pm) {
+    auto& logger = Logger::instance();
+
+    // Map the module source; the buffer only needs to live for the parse,
+    // since the parser copies token text into its AST nodes
+    auto source = SourceBuffer::open(pm.resolvedPath);
+    if (!source) {
+        logger.error("Cannot open module file: " + pm.resolvedPath);
+        return;
     }
-    
-    std::stringstream buffer;
-    buffer << file.rdbuf();
-    std::string source = buffer.str();
-    
-    logger.debug("Loaded module source: " + filePath + " (" + std::to_string(source.length()) + " bytes)", "Modules");
-    
+
+    logger.debug([&] {
+        return "Loaded module source: " + pm.resolvedPath + " (" +
+               std::to_string(source->size()) + " bytes)";
+    }, "Modules");
+
+    if (logger.phaseMetricsEnabled()) {
+        logger.phaseStart("Module parse: " + pm.importPath);
+    }
+
     try {
-        // Parse the module
-        Lexer lexer(source);
+        // Parse the module into its own arena
+        pm.arena = std::make_unique<ASTArena>();
+        ASTArenaScope arena_scope(*pm.arena);
+
+        Lexer lexer(source->contents());
         Parser parser(lexer);
-        auto functions = parser.parseProgram();
-        auto& classes = parser.getClasses();
-        auto& subImports = parser.getImports();
-        
-        logger.debug("Module contains " + std::to_string(functions.size()) + 
-                    " function(s) and " + std::to_string(classes.size()) + " class(es)", "Modules");
-        
+        pm.functions = parser.parseProgram();
+        pm.classes = std::move(parser.getClasses());
+        pm.imports = std::move(parser.getImports());
+
+        logger.debug([&] {
+            return "Module contains " + std::to_string(pm.functions.size()) +
+                   " function(s) and " + std::to_string(pm.classes.size()) + " class(es)";
+        }, "Modules");
+
         // Get package name from parsed module
-        std::string modulePackage;
         if (parser.getPackage()) {
-            modulePackage = parser.getPackage()->getPackageName();
-            logger.debug("Module package: " + modulePackage, "Modules");
-        }
-        
-        // Process sub-imports recursively
-        for (auto& subImport : subImports) {
-            if (!subImport->load(filePath, modulePackage)) {
-                logger.error("Failed to load sub-import: " + subImport->getModulePath());
-                return false;
-            }
+            pm.package = parser.getPackage()->getPackageName();
+            logger.debug("Module package: " + pm.package, "Modules");
         }
-        
+
+        pm.ok = true;
+    } catch (const std::exception& e) {
+        logger.error("Error loading module " + pm.importPath + ": " + std::string(e.what()));
+    }
+
+    if (logger.phaseMetricsEnabled()) {
+        logger.phaseEnd("Module parse: " + pm.importPath, pm.ok);
+    }
+}
+
+static bool codegenModuleImpl(ParsedModule& pm);
+
+/// Generate code for a parsed module into the global LLVM module.
+/// Must run on the main thread - the codegen context is not shared-safe.
+static bool codegenModule(ParsedModule& pm) {
+    auto& logger = Logger::instance();
+
+    if (logger.phaseMetricsEnabled()) {
+        logger.phaseStart("Module codegen: " + pm.importPath);
+    }
+
+    bool ok = codegenModuleImpl(pm);
+
+    if (logger.phaseMetricsEnabled()) {
+        logger.phaseEnd("Module codegen: " + pm.importPath, ok);
+    }
+    return ok;
+}
+
+static bool codegenModuleImpl(ParsedModule& pm) {
+    auto& logger = Logger::instance();
+
+    try {
         // Generate code for classes
-        for (auto& classDecl : classes) {
+        for (auto& classDecl : pm.classes) {
             llvm::Type* classType = classDecl->codegen();
             if (!classType) {
                 logger.error("Failed to generate struct type for class: " + classDecl->getName());
                 return false;
             }
         }
-        
-        for (auto& classDecl : classes) {
+
+        for (auto& classDecl : pm.classes) {
             classDecl->codegenMethods();
         }
-        
+
         // Generate code for functions
-        for (auto& func : functions) {
+        for (auto& func : pm.functions) {
             llvm::Function* llvm_func = func->codegen();
             if (!llvm_func) {
                 logger.error("Failed to generate code for function: " + func->getProto()->getName());
                 return false;
             }
         }
-        
-        // Mark module as loaded
-        loadedModules.insert(modulePath);
-        
-        logger.debug("Successfully loaded module: " + modulePath, "Modules");
         return true;
-        
+
     } catch (const std::exception& e) {
-        logger.error("Error loading module " + modulePath + ": " + std::string(e.what()));
+        logger.error("Error loading module " + pm.importPath + ": " + std::string(e.what()));
+        return false;
+    }
+}
+
+/// Lower parsed[idx] after every sub-import it recorded during its
+/// parse (post-order over the import graph, so callees exist before
+/// callers). `state` is 0 for unvisited, 1 while a module's
+/// dependencies are being emitted, and 2 once it is lowered; seeing a
+/// non-zero state again either means the module is done or the import
+/// graph has a cycle, which is broken here the same way the
+/// loadedModules guard breaks it across loads.
+static bool codegenPostOrder(std::vector<ParsedModule>& parsed,
+                             const std::map<std::string, size_t>& moduleIndex,
+                             std::vector<char>& state,
+                             size_t idx) {
+    if (state[idx] != 0) {
+        return true;
+    }
+    state[idx] = 1;
+    for (const auto& subImport : parsed[idx].imports) {
+        // Edges to modules loaded by an earlier call have no entry
+        auto it = moduleIndex.find(subImport->getModulePath());
+        if (it != moduleIndex.end() &&
+            !codegenPostOrder(parsed, moduleIndex, state, it->second)) {
+            return false;
+        }
+    }
+    state[idx] = 2;
+    if (!codegenModule(parsed[idx])) {
         return false;
     }
+    std::lock_guard<std::mutex> lock(moduleRegistryMutex);
+    loadedModules.insert(parsed[idx].importPath);
+    loadedModuleFiles.insert(parsed[idx].resolvedPath);
+    return true;
+}
+
+bool ImportDecl::load(const std::string& currentFile, const std::string& currentPackage) {
+    auto& logger = Logger::instance();
+
+    // Initialize module system if not already done
+    if (!moduleSystemInitialized) {
+        initializeModuleSystem();
+    }
+
+    // Check if module is already loaded
+    {
+        std::lock_guard<std::mutex> lock(moduleRegistryMutex);
+        if (loadedModules.count(modulePath) > 0) {
+            logger.debug("Module already loaded: " + modulePath, "Modules");
+            return true;
+        }
+    }
+
+    // Discover and parse the import graph in waves: within a wave the
+    // modules are independent, so file reading, lexing, and parsing run
+    // on worker threads. Codegen into the shared LLVM module stays on
+    // this thread, deepest modules first so callees exist before callers.
+    std::vector<ParsedModule> parsed;                            // discovery order
+    std::set<std::string> scheduled;                             // dedup within this load
+    std::vector<std::pair<std::string, std::string>> frontier;   // {import path, importing file}
+    frontier.push_back({modulePath, currentFile});
+    scheduled.insert(modulePath);
+
+    while (!frontier.empty()) {
+        // Resolve this wave serially (cheap filesystem checks). Indexed
+        // loop: cached interfaces may append sub-imports to the frontier
+        // while it is being walked.
+        std::vector<ParsedModule> wave;
+        for (size_t i = 0; i < frontier.size(); ++i) {
+            auto [path, fromFile] = frontier[i];
+            {
+                std::lock_guard<std::mutex> lock(moduleRegistryMutex);
+                if (loadedModules.count(path) > 0) {
+                    continue;
+                }
+            }
+            std::string resolved = resolveModuleFile(path, fromFile);
+            if (resolved.empty()) {
+                return false;
+            }
+            ParsedModule pm;
+            pm.importPath = path;
+            pm.resolvedPath = resolved;
+
+            // A fresh .aurm interface lets us schedule this module's
+            // sub-imports into the same wave without waiting for its
+            // parse, and pre-register its class types so sibling parses
+            // can resolve them.
+            ModuleInterface interface;
+            if (ModuleSerializer::read(resolved, interface)) {
+                auto& registry = TypeRegistry::instance();
+                for (const auto& classSig : interface.classes) {
+                    registry.getClassType(classSig.name);
+                }
+                for (const auto& subPath : interface.imports) {
+                    if (scheduled.insert(subPath).second) {
+                        frontier.push_back({subPath, resolved});
+                    }
+                }
+            } else {
+                pm.writeCache = true;
+            }
+
+            wave.push_back(std::move(pm));
+        }
+        frontier.clear();
+
+        // Parse the wave in parallel (single-module waves stay inline)
+        if (wave.size() > 1) {
+            std::vector<std::future<void>> futures;
+            futures.reserve(wave.size());
+            for (auto& pm : wave) {
+                futures.push_back(std::async(std::launch::async,
+                                             [&pm] { parseModuleFile(pm); }));
+            }
+            for (auto& future : futures) {
+                future.get();
+            }
+        } else {
+            for (auto& pm : wave) {
+                parseModuleFile(pm);
+            }
+        }
+
+        // Collect results and schedule the next wave of sub-imports
+        for (auto& pm : wave) {
+            if (!pm.ok) {
+                logger.error("Failed to load sub-import: " + pm.importPath);
+                return false;
+            }
+            for (auto& subImport : pm.imports) {
+                if (scheduled.insert(subImport->getModulePath()).second) {
+                    frontier.push_back({subImport->getModulePath(), pm.resolvedPath});
+                }
+            }
+            if (pm.writeCache) {
+                ModuleSerializer::write(pm.resolvedPath, pm.functions, pm.classes, pm.imports);
+            }
+            parsed.push_back(std::move(pm));
+        }
+    }
+
+    // Sequential codegen in post-order over the import graph. Reverse
+    // discovery order is not enough: when two same-wave modules share a
+    // dependency, the frontier dedup records it under whichever was
+    // resolved first, and the other would be lowered before it.
+    std::map<std::string, size_t> moduleIndex;
+    for (size_t i = 0; i < parsed.size(); ++i) {
+        moduleIndex.emplace(parsed[i].importPath, i);
+    }
+    std::vector<char> state(parsed.size(), 0);
+    for (size_t i = 0; i < parsed.size(); ++i) {
+        if (!codegenPostOrder(parsed, moduleIndex, state, i)) {
+            return false;
+        }
+    }
+
+    logger.debug("Successfully loaded module: " + modulePath, "Modules");
+    return true;
 }
 
 } // namespace aurora
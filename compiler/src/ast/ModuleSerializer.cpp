@@ -0,0 +1,302 @@
+#include "aurora/ModuleSerializer.h"
+#include "aurora/AST.h"
+#include "aurora/Logger.h"
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace aurora {
+
+// .aurm binary layout (little-endian):
+//   magic 'AURM', u32 format version
+//   u64 source size, i64 source mtime (staleness check)
+//   imports, function prototypes, class layouts as counted records
+//   with u32 length-prefixed strings
+static constexpr char kMagic[4] = {'A', 'U', 'R', 'M'};
+static constexpr uint32_t kFormatVersion = 1;
+
+static void writeU32(std::ostream& out, uint32_t value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+static void writeU64(std::ostream& out, uint64_t value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+static void writeString(std::ostream& out, const std::string& str) {
+    writeU32(out, static_cast<uint32_t>(str.size()));
+    out.write(str.data(), static_cast<std::streamsize>(str.size()));
+}
+
+static bool readU32(std::istream& in, uint32_t& value) {
+    in.read(reinterpret_cast<char*>(&value), sizeof(value));
+    return in.good();
+}
+
+static bool readU64(std::istream& in, uint64_t& value) {
+    in.read(reinterpret_cast<char*>(&value), sizeof(value));
+    return in.good();
+}
+
+static bool readString(std::istream& in, std::string& str) {
+    uint32_t length = 0;
+    if (!readU32(in, length) || length > (1u << 24)) {
+        return false;
+    }
+    str.resize(length);
+    in.read(&str[0], length);
+    return in.good() || (length == 0 && !in.bad());
+}
+
+/// Source size and mtime used to detect stale caches
+static bool sourceStamp(const std::string& sourcePath, uint64_t& size, uint64_t& mtime) {
+    std::error_code ec;
+    size = std::filesystem::file_size(sourcePath, ec);
+    if (ec) {
+        return false;
+    }
+    auto time = std::filesystem::last_write_time(sourcePath, ec);
+    if (ec) {
+        return false;
+    }
+    mtime = static_cast<uint64_t>(time.time_since_epoch().count());
+    return true;
+}
+
+std::string ModuleSerializer::cachePathFor(const std::string& sourcePath) {
+    return sourcePath + "m";  // foo.aur -> foo.aurm
+}
+
+bool ModuleSerializer::write(const std::string& sourcePath,
+                             const std::vector<std::unique_ptr<Function>>& functions,
+                             const std::vector<std::unique_ptr<ClassDecl>>& classes,
+                             const std::vector<std::unique_ptr<ImportDecl>>& imports) {
+    uint64_t size = 0, mtime = 0;
+    if (!sourceStamp(sourcePath, size, mtime)) {
+        return false;
+    }
+
+    std::string cachePath = cachePathFor(sourcePath);
+    std::ofstream out(cachePath, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        // Read-only module directories are expected; skip quietly
+        Logger::instance().debug("Cannot write module cache: " + cachePath, "Modules");
+        return false;
+    }
+
+    out.write(kMagic, sizeof(kMagic));
+    writeU32(out, kFormatVersion);
+    writeU64(out, size);
+    writeU64(out, mtime);
+
+    writeU32(out, static_cast<uint32_t>(imports.size()));
+    for (const auto& import : imports) {
+        writeString(out, import->getModulePath());
+    }
+
+    writeU32(out, static_cast<uint32_t>(functions.size()));
+    for (const auto& func : functions) {
+        const Prototype* proto = func->getProto();
+        writeString(out, proto->getName());
+        writeString(out, proto->getReturnType()->getMangledName());
+        writeU32(out, static_cast<uint32_t>(proto->getParams().size()));
+        for (const auto& param : proto->getParams()) {
+            writeString(out, param.name);
+            writeString(out, param.type->getMangledName());
+        }
+    }
+
+    writeU32(out, static_cast<uint32_t>(classes.size()));
+    for (const auto& classDecl : classes) {
+        writeString(out, classDecl->getName());
+        out.put(classDecl->isObjectSingleton() ? 1 : 0);
+
+        writeU32(out, static_cast<uint32_t>(classDecl->getFields().size()));
+        for (const auto& field : classDecl->getFields()) {
+            writeString(out, field.name);
+            writeString(out, field.type->getMangledName());
+            out.put(field.isPublic ? 1 : 0);
+        }
+
+        writeU32(out, static_cast<uint32_t>(classDecl->getMethods().size()));
+        for (const auto& method : classDecl->getMethods()) {
+            writeString(out, method.name);
+            writeString(out, method.returnType->getMangledName());
+            out.put(static_cast<char>((method.isPublic ? 1 : 0) |
+                                      (method.isStatic ? 2 : 0) |
+                                      (method.isConstructor ? 4 : 0)));
+            writeU32(out, static_cast<uint32_t>(method.params.size()));
+            for (const auto& param : method.params) {
+                writeString(out, param.name);
+                writeString(out, param.type->getMangledName());
+            }
+        }
+    }
+
+    if (!out.good()) {
+        out.close();
+        std::error_code ec;
+        std::filesystem::remove(cachePath, ec);
+        return false;
+    }
+
+    Logger::instance().debug("Wrote module cache: " + cachePath, "Modules");
+    return true;
+}
+
+bool ModuleSerializer::read(const std::string& sourcePath, ModuleInterface& out) {
+    std::string cachePath = cachePathFor(sourcePath);
+    std::ifstream in(cachePath, std::ios::binary);
+    if (!in) {
+        return false;
+    }
+
+    char magic[4];
+    in.read(magic, sizeof(magic));
+    uint32_t version = 0;
+    if (!in.good() || std::memcmp(magic, kMagic, sizeof(kMagic)) != 0 ||
+        !readU32(in, version) || version != kFormatVersion) {
+        return false;
+    }
+
+    uint64_t cachedSize = 0, cachedMtime = 0;
+    if (!readU64(in, cachedSize) || !readU64(in, cachedMtime)) {
+        return false;
+    }
+
+    uint64_t size = 0, mtime = 0;
+    if (!sourceStamp(sourcePath, size, mtime) || size != cachedSize || mtime != cachedMtime) {
+        Logger::instance().debug("Stale module cache: " + cachePath, "Modules");
+        return false;
+    }
+
+    uint32_t importCount = 0;
+    if (!readU32(in, importCount)) {
+        return false;
+    }
+    out.imports.resize(importCount);
+    for (auto& import : out.imports) {
+        if (!readString(in, import)) {
+            return false;
+        }
+    }
+
+    uint32_t functionCount = 0;
+    if (!readU32(in, functionCount)) {
+        return false;
+    }
+    out.functions.resize(functionCount);
+    for (auto& func : out.functions) {
+        uint32_t paramCount = 0;
+        if (!readString(in, func.name) || !readString(in, func.returnType) ||
+            !readU32(in, paramCount)) {
+            return false;
+        }
+        func.params.resize(paramCount);
+        for (auto& param : func.params) {
+            if (!readString(in, param.first) || !readString(in, param.second)) {
+                return false;
+            }
+        }
+    }
+
+    uint32_t classCount = 0;
+    if (!readU32(in, classCount)) {
+        return false;
+    }
+    out.classes.resize(classCount);
+    for (auto& classSig : out.classes) {
+        if (!readString(in, classSig.name)) {
+            return false;
+        }
+        classSig.isSingleton = in.get() == 1;
+
+        uint32_t fieldCount = 0;
+        if (!readU32(in, fieldCount)) {
+            return false;
+        }
+        classSig.fields.resize(fieldCount);
+        for (auto& field : classSig.fields) {
+            if (!readString(in, field.name) || !readString(in, field.type)) {
+                return false;
+            }
+            field.isPublic = in.get() == 1;
+        }
+
+        uint32_t methodCount = 0;
+        if (!readU32(in, methodCount)) {
+            return false;
+        }
+        classSig.methods.resize(methodCount);
+        for (auto& method : classSig.methods) {
+            if (!readString(in, method.name) || !readString(in, method.returnType)) {
+                return false;
+            }
+            int flags = in.get();
+            method.isPublic = (flags & 1) != 0;
+            method.isStatic = (flags & 2) != 0;
+            method.isConstructor = (flags & 4) != 0;
+            uint32_t paramCount = 0;
+            if (!readU32(in, paramCount)) {
+                return false;
+            }
+            method.params.resize(paramCount);
+            for (auto& param : method.params) {
+                if (!readString(in, param.first) || !readString(in, param.second)) {
+                    return false;
+                }
+            }
+        }
+    }
+
+    Logger::instance().debug("Loaded module cache: " + cachePath, "Modules");
+    return true;
+}
+
+/// Recursive-descent decode of a mangled type name; `pos` is advanced
+/// past the consumed encoding
+static Type* decodeType(const std::string& mangled, size_t& pos) {
+    if (pos >= mangled.size()) {
+        return nullptr;
+    }
+
+    auto& registry = TypeRegistry::instance();
+    char tag = mangled[pos++];
+    switch (tag) {
+        case 'v': return registry.getVoidType();
+        case 'i': return registry.getIntType();
+        case 'd': return registry.getDoubleType();
+        case 'b': return registry.getBoolType();
+        case 's': return registry.getStringType();
+        case 'o': {
+            auto inner = decodeType(mangled, pos);
+            return inner ? registry.getOptionalType(inner) : nullptr;
+        }
+        case 'a': {
+            auto element = decodeType(mangled, pos);
+            return element ? registry.getArrayType(element) : nullptr;
+        }
+        case 'c': {
+            // Class names are not length-prefixed in the mangling, so a
+            // class type consumes the rest of the encoding. Nested class
+            // types only ever appear in tail position (o/a prefixes).
+            std::string name = mangled.substr(pos);
+            pos = mangled.size();
+            return name.empty() ? nullptr : registry.getClassType(name);
+        }
+        default:
+            return nullptr;
+    }
+}
+
+Type* ModuleSerializer::typeFromMangledName(const std::string& mangled) {
+    size_t pos = 0;
+    auto type = decodeType(mangled, pos);
+    if (!type || pos != mangled.size()) {
+        return nullptr;
+    }
+    return type;
+}
+
+} // namespace aurora
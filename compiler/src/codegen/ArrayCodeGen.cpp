@@ -15,6 +15,49 @@ static llvm::Value* logError(const char* str, const char* code = "E3001") {
     return nullptr;
 }
 
+// LLVM mirror of the runtime's AuroraArray:
+// struct { AuroraRefCountHeader header; int64_t length; int64_t capacity; char data[]; }
+// AuroraRefCountHeader is: struct { int64_t ref_count; int32_t type; uint32_t flags; }
+static llvm::StructType* getRuntimeArrayType(CodeGenContext& ctx) {
+    llvm::StructType* refCountHeaderType = llvm::StructType::get(ctx.getContext(),
+        {llvm::Type::getInt64Ty(ctx.getContext()),    // ref_count
+         llvm::Type::getInt32Ty(ctx.getContext()),    // type (enum)
+         llvm::Type::getInt32Ty(ctx.getContext())});  // flags
+
+    return llvm::StructType::get(ctx.getContext(),
+        {refCountHeaderType,                                           // header (field 0)
+         llvm::Type::getInt64Ty(ctx.getContext()),                     // length (field 1)
+         llvm::Type::getInt64Ty(ctx.getContext()),                     // capacity (field 2)
+         llvm::ArrayType::get(llvm::Type::getInt8Ty(ctx.getContext()), 0)}); // data[] (field 3)
+}
+
+// Recover the AuroraArray* from the inline-data pointer carried in the
+// language-level {length, data} struct: the elements start at a fixed
+// offset inside the same allocation
+static llvm::Value* getRuntimeArrayPtr(CodeGenContext& ctx, llvm::Value* dataPtr) {
+    const llvm::StructLayout* layout =
+        ctx.getModule().getDataLayout().getStructLayout(getRuntimeArrayType(ctx));
+    llvm::Value* negOffset = llvm::ConstantInt::get(
+        llvm::Type::getInt64Ty(ctx.getContext()),
+        -static_cast<int64_t>(layout->getElementOffset(3)));
+    return ctx.getBuilder().CreateGEP(
+        llvm::Type::getInt8Ty(ctx.getContext()), dataPtr, negOffset, "array_rt");
+}
+
+// Declare (once) a runtime entry point taking an AuroraArray* and
+// returning the possibly-moved AuroraArray*
+static llvm::Function* getArrayRuntimeFn(CodeGenContext& ctx, const char* name,
+                                         std::vector<llvm::Type*> paramTypes) {
+    llvm::Function* func = ctx.getModule().getFunction(name);
+    if (!func) {
+        llvm::FunctionType* funcType = llvm::FunctionType::get(
+            llvm::PointerType::get(ctx.getContext(), 0), paramTypes, false);
+        func = llvm::Function::Create(funcType, llvm::Function::ExternalLinkage,
+                                      name, ctx.getModule());
+    }
+    return func;
+}
+
 // ===== Array Literal Expression =====
 // Uses Runtime API (aurora_array_create)
 
@@ -22,7 +65,7 @@ llvm::Value* ArrayLiteralExpr::codegen() {
     auto& ctx = getGlobalContext();
     
     // Get the element type from the array type
-    auto arrayType = std::dynamic_pointer_cast<ArrayType>(type);
+    auto arrayType = dynamic_cast<ArrayType*>(type);
     if (!arrayType) {
         return logError("ArrayLiteralExpr has non-array type");
     }
@@ -54,69 +97,27 @@ llvm::Value* ArrayLiteralExpr::codegen() {
     llvm::Value* runtimeArray = ctx.getBuilder().CreateCall(
         arrayCreateFunc, {elemSizeVal, elemCountVal}, "array");
     
-    // Declare aurora_array_set if needed
-    llvm::Function* arraySetFunc = ctx.getModule().getFunction("aurora_array_set");
-    if (!arraySetFunc) {
-        // void aurora_array_set(AuroraArray* array, int64_t index, void* element, int64_t element_size)
-        llvm::FunctionType* funcType = llvm::FunctionType::get(
-            llvm::Type::getVoidTy(ctx.getContext()),
-            {llvm::PointerType::get(ctx.getContext(), 0),
-             llvm::Type::getInt64Ty(ctx.getContext()),
-             llvm::PointerType::get(ctx.getContext(), 0),
-             llvm::Type::getInt64Ty(ctx.getContext())},
-            false);
-        arraySetFunc = llvm::Function::Create(funcType,
-            llvm::Function::ExternalLinkage,
-            "aurora_array_set", ctx.getModule());
-    }
+    // Get pointer to the inline element storage; the elements start
+    // right inside the same allocation - no load
+    llvm::StructType* runtimeArrayType = getRuntimeArrayType(ctx);
+    llvm::Value* dataPtr = ctx.getBuilder().CreateStructGEP(
+        runtimeArrayType, runtimeArray, 3, "array_data");
     
-    // Store elements using runtime API
+    // Store elements with direct GEPs; going through aurora_array_set
+    // would hide these stores from the loop optimizer behind opaque calls
     for (size_t i = 0; i < numElements; ++i) {
         llvm::Value* elemVal = elements[i]->codegen();
         if (!elemVal) return nullptr;
         
-        // Allocate temporary storage for element
-        llvm::AllocaInst* elemAlloca = ctx.getBuilder().CreateAlloca(elemLLVMType, nullptr, "elem_tmp");
-        ctx.getBuilder().CreateStore(elemVal, elemAlloca);
-        
-        // Call aurora_array_set
-        llvm::Value* indexVal = llvm::ConstantInt::get(
-            llvm::Type::getInt64Ty(ctx.getContext()), i);
-        ctx.getBuilder().CreateCall(arraySetFunc, 
-            {runtimeArray, indexVal, elemAlloca, elemSizeVal});
-    }
-    
-    // Convert runtime array pointer to our array struct format
-    llvm::Function* arrayGetLengthFunc = ctx.getModule().getFunction("aurora_array_length");
-    if (!arrayGetLengthFunc) {
-        llvm::FunctionType* funcType = llvm::FunctionType::get(
-            llvm::Type::getInt64Ty(ctx.getContext()),
-            {llvm::PointerType::get(ctx.getContext(), 0)},
-            false);
-        arrayGetLengthFunc = llvm::Function::Create(funcType,
-            llvm::Function::ExternalLinkage,
-            "aurora_array_length", ctx.getModule());
+        llvm::Value* elemPtr = ctx.getBuilder().CreateGEP(
+            elemLLVMType, dataPtr,
+            llvm::ConstantInt::get(llvm::Type::getInt64Ty(ctx.getContext()), i),
+            "elem_ptr");
+        ctx.getBuilder().CreateStore(elemVal, elemPtr);
     }
     
-    // Get length
-    llvm::Value* length = ctx.getBuilder().CreateCall(arrayGetLengthFunc, {runtimeArray}, "length");
-    
-    // Get data pointer (access AuroraArray->data field)
-    // AuroraArray is: struct { AuroraRefCountHeader header; int64_t length; void* data; }
-    // AuroraRefCountHeader is: struct { int64_t ref_count; int32_t type; }
-    llvm::StructType* refCountHeaderType = llvm::StructType::get(ctx.getContext(),
-        {llvm::Type::getInt64Ty(ctx.getContext()),    // ref_count
-         llvm::Type::getInt32Ty(ctx.getContext())});  // type (enum)
-    
-    llvm::StructType* runtimeArrayType = llvm::StructType::get(ctx.getContext(),
-        {refCountHeaderType,                           // header (field 0)
-         llvm::Type::getInt64Ty(ctx.getContext()),     // length (field 1)
-         llvm::PointerType::get(ctx.getContext(), 0)}); // data (field 2)
-    
-    llvm::Value* dataFieldPtr = ctx.getBuilder().CreateStructGEP(
-        runtimeArrayType, runtimeArray, 2, "data_field_ptr");  // Field 2, not 1!
-    llvm::Value* dataPtr = ctx.getBuilder().CreateLoad(
-        llvm::PointerType::get(ctx.getContext(), 0), dataFieldPtr, "data");
+    // The length is statically known; no need to call back into the runtime
+    llvm::Value* length = elemCountVal;
     
     // Create our array struct: {length, data}
     llvm::Type* arrayStructType = type->toLLVMType(ctx.getContext());
@@ -148,12 +149,18 @@ llvm::Value* ArrayIndexExpr::codegen() {
                 llvm::Type::getInt64Ty(ctx.getContext()), "idx_ext");
         }
     }
-    
+
+    // Bounds check, unless the index is provably inside a
+    // statically-sized array
+    if (!ctx.arrayIndexProvablySafe(array.get(), index.get())) {
+        ctx.insertArrayBoundsCheck(arrayVal, indexVal);
+    }
+
     // Extract data pointer from array struct
     llvm::Value* dataPtr = ctx.getBuilder().CreateExtractValue(arrayVal, 1, "array_data");
     
     // Get element type
-    auto arrayType = std::dynamic_pointer_cast<ArrayType>(array->getType());
+    auto arrayType = dynamic_cast<ArrayType*>(array->getType());
     if (!arrayType) {
         return logError("Array index on non-array type");
     }
@@ -174,13 +181,180 @@ llvm::Value* ArrayIndexExpr::codegen() {
     return ctx.getBuilder().CreateLoad(elemType, elemPtr, "elem");
 }
 
-std::shared_ptr<Type> ArrayIndexExpr::getType() const {
-    auto arrayType = std::dynamic_pointer_cast<ArrayType>(array->getType());
+Type* ArrayIndexExpr::getType() const {
+    auto arrayType = dynamic_cast<ArrayType*>(array->getType());
     if (arrayType) {
         return arrayType->getElementType();
     }
     return TypeRegistry::instance().getIntType(); // fallback
 }
 
+// ===== Built-in Array Methods =====
+// arr.size() / arr.append(v) / arr.reserve(n) / arr.shrinkToFit()
+//
+// size() reads the length already carried in the language-level
+// {length, data} struct. The mutating methods may move the allocation,
+// so they require the receiver to be a plain variable: the refreshed
+// struct is stored back into its alloca. append keeps its fast path
+// inline - a capacity compare, a store and a length bump - and only
+// calls into the runtime when the array is full.
+
+llvm::Value* codegenArrayMemberCall(MemberCallExpr& call) {
+    auto& ctx = getGlobalContext();
+    Expr* object = call.getObject();
+    const std::string& method = call.getMethod();
+    const auto& args = call.getArgs();
+
+    auto* arrayType = dynamic_cast<ArrayType*>(object->getType());
+    if (!arrayType) {
+        if (auto* varExpr = dynamic_cast<VariableExpr*>(object)) {
+            arrayType = dynamic_cast<ArrayType*>(ctx.getVariableType(varExpr->getName()));
+        }
+    }
+    if (!arrayType) {
+        return logError("Cannot determine array type for method call");
+    }
+
+    llvm::Value* arrayVal = object->codegen();
+    if (!arrayVal) return nullptr;
+
+    llvm::Type* i64Type = llvm::Type::getInt64Ty(ctx.getContext());
+    llvm::Type* ptrType = llvm::PointerType::get(ctx.getContext(), 0);
+
+    if (method == "size") {
+        if (!args.empty()) {
+            return logError("size() takes no arguments");
+        }
+        return ctx.getBuilder().CreateExtractValue(arrayVal, 0, "array_len");
+    }
+
+    // The mutators rebind the receiver, so it must be a named variable
+    auto* varExpr = dynamic_cast<VariableExpr*>(object);
+    llvm::AllocaInst* slot =
+        varExpr ? ctx.getNamedValues().lookup(varExpr->getName()) : nullptr;
+    if (!slot) {
+        return logError(("Array method '" + method +
+                         "' requires an array variable").c_str());
+    }
+
+    llvm::Type* elemType = arrayType->getElementType()->toLLVMType(ctx.getContext());
+    uint64_t elemSize = ctx.getModule().getDataLayout().getTypeAllocSize(elemType);
+    llvm::Value* elemSizeVal = llvm::ConstantInt::get(i64Type, elemSize);
+
+    llvm::StructType* runtimeArrayType = getRuntimeArrayType(ctx);
+    llvm::Value* length = ctx.getBuilder().CreateExtractValue(arrayVal, 0, "array_len");
+    llvm::Value* dataPtr = ctx.getBuilder().CreateExtractValue(arrayVal, 1, "array_data");
+    llvm::Value* rtPtr = getRuntimeArrayPtr(ctx, dataPtr);
+
+    // Rebuild the language struct from a (possibly moved) runtime array
+    auto reloadStruct = [&](llvm::Value* rt) -> llvm::Value* {
+        llvm::Value* newLen = ctx.getBuilder().CreateLoad(i64Type,
+            ctx.getBuilder().CreateStructGEP(runtimeArrayType, rt, 1), "array_len");
+        llvm::Value* newData = ctx.getBuilder().CreateStructGEP(
+            runtimeArrayType, rt, 3, "array_data");
+        llvm::Value* result = llvm::UndefValue::get(arrayVal->getType());
+        result = ctx.getBuilder().CreateInsertValue(result, newLen, 0);
+        return ctx.getBuilder().CreateInsertValue(result, newData, 1);
+    };
+
+    if (method == "append") {
+        if (args.size() != 1) {
+            return logError("append() takes exactly one argument");
+        }
+        llvm::Value* elemVal = args[0]->codegen();
+        if (!elemVal) return nullptr;
+        if (elemVal->getType() != elemType) {
+            if (elemVal->getType()->isIntegerTy() && elemType->isDoubleTy()) {
+                elemVal = ctx.getBuilder().CreateSIToFP(elemVal, elemType, "elem_conv");
+            } else if (elemVal->getType()->isDoubleTy() && elemType->isIntegerTy()) {
+                elemVal = ctx.getBuilder().CreateFPToSI(elemVal, elemType, "elem_conv");
+            }
+        }
+
+        llvm::Function* function = ctx.getBuilder().GetInsertBlock()->getParent();
+        llvm::Value* capacity = ctx.getBuilder().CreateLoad(i64Type,
+            ctx.getBuilder().CreateStructGEP(runtimeArrayType, rtPtr, 2), "array_cap");
+        llvm::Value* isFull = ctx.getBuilder().CreateICmpEQ(length, capacity, "array_full");
+
+        llvm::BasicBlock* grow_bb =
+            llvm::BasicBlock::Create(ctx.getContext(), "appendgrow", function);
+        llvm::BasicBlock* fast_bb =
+            llvm::BasicBlock::Create(ctx.getContext(), "appendfast", function);
+        llvm::BasicBlock* merge_bb =
+            llvm::BasicBlock::Create(ctx.getContext(), "appendmerge", function);
+        ctx.getBuilder().CreateCondBr(isFull, grow_bb, fast_bb);
+
+        // Fast path: store at data[length], bump the header length
+        ctx.getBuilder().SetInsertPoint(fast_bb);
+        llvm::Value* elemPtr =
+            ctx.getBuilder().CreateGEP(elemType, dataPtr, length, "elem_ptr");
+        ctx.getBuilder().CreateStore(elemVal, elemPtr);
+        llvm::Value* bumped = ctx.getBuilder().CreateAdd(
+            length, llvm::ConstantInt::get(i64Type, 1), "new_len");
+        ctx.getBuilder().CreateStore(bumped,
+            ctx.getBuilder().CreateStructGEP(runtimeArrayType, rtPtr, 1));
+        llvm::Value* fastStruct = ctx.getBuilder().CreateInsertValue(arrayVal, bumped, 0);
+        ctx.getBuilder().CreateBr(merge_bb);
+        llvm::BasicBlock* fast_end = ctx.getBuilder().GetInsertBlock();
+
+        // Slow path: the runtime grows (and possibly moves) the array
+        ctx.getBuilder().SetInsertPoint(grow_bb);
+        llvm::AllocaInst* tmp = ctx.createEntryBlockAlloca(function, "append_tmp", elemType);
+        ctx.getBuilder().CreateStore(elemVal, tmp);
+        llvm::Function* appendFunc = getArrayRuntimeFn(
+            ctx, "aurora_array_append", {ptrType, ptrType, i64Type});
+        llvm::Value* movedRt = ctx.getBuilder().CreateCall(
+            appendFunc, {rtPtr, tmp, elemSizeVal}, "array_moved");
+        llvm::Value* growStruct = reloadStruct(movedRt);
+        ctx.getBuilder().CreateBr(merge_bb);
+        llvm::BasicBlock* grow_end = ctx.getBuilder().GetInsertBlock();
+
+        ctx.getBuilder().SetInsertPoint(merge_bb);
+        llvm::PHINode* merged =
+            ctx.getBuilder().CreatePHI(arrayVal->getType(), 2, "array_next");
+        merged->addIncoming(fastStruct, fast_end);
+        merged->addIncoming(growStruct, grow_end);
+        ctx.getBuilder().CreateStore(merged, slot);
+        return merged;
+    }
+
+    if (method == "reserve") {
+        if (args.size() != 1) {
+            return logError("reserve() takes exactly one argument");
+        }
+        llvm::Value* wanted = args[0]->codegen();
+        if (!wanted) return nullptr;
+        if (!wanted->getType()->isIntegerTy(64)) {
+            if (wanted->getType()->isDoubleTy()) {
+                wanted = ctx.getBuilder().CreateFPToSI(wanted, i64Type, "cap_conv");
+            } else if (wanted->getType()->isIntegerTy()) {
+                wanted = ctx.getBuilder().CreateZExtOrTrunc(wanted, i64Type, "cap_ext");
+            }
+        }
+        llvm::Function* reserveFunc = getArrayRuntimeFn(
+            ctx, "aurora_array_reserve", {ptrType, i64Type, i64Type});
+        llvm::Value* movedRt = ctx.getBuilder().CreateCall(
+            reserveFunc, {rtPtr, wanted, elemSizeVal}, "array_moved");
+        llvm::Value* refreshed = reloadStruct(movedRt);
+        ctx.getBuilder().CreateStore(refreshed, slot);
+        return refreshed;
+    }
+
+    if (method == "shrinkToFit") {
+        if (!args.empty()) {
+            return logError("shrinkToFit() takes no arguments");
+        }
+        llvm::Function* shrinkFunc = getArrayRuntimeFn(
+            ctx, "aurora_array_shrink_to_fit", {ptrType, i64Type});
+        llvm::Value* movedRt = ctx.getBuilder().CreateCall(
+            shrinkFunc, {rtPtr, elemSizeVal}, "array_moved");
+        llvm::Value* refreshed = reloadStruct(movedRt);
+        ctx.getBuilder().CreateStore(refreshed, slot);
+        return refreshed;
+    }
+
+    return logError(("Unknown array method: " + method).c_str());
+}
+
 } // namespace aurora
 
@@ -1,8 +1,10 @@
 #include "aurora/AST.h"
 #include "aurora/CodeGen.h"
 #include "aurora/Diagnostic.h"
+#include "aurora/EscapeAnalysis.h"
 #include <llvm/IR/Constants.h>
 #include <llvm/IR/Function.h>
+#include <llvm/IR/GlobalVariable.h>
 #include <llvm/IR/Type.h>
 #include <llvm/IR/Verifier.h>
 
@@ -34,6 +36,74 @@ static std::string mangleMethodName(const std::string& className,
     return mangledName;
 }
 
+// ===== Virtual Method Tables =====
+
+// Every object carries a pointer to its class vtable in struct slot 0;
+// declared fields start after it. The vtable is a compact constant array of
+// the class's dispatchable method pointers in declaration order (constructors
+// are excluded - they are never dispatched). The language has no inheritance
+// yet, so the static type of an expression is always the exact type: every
+// class is final, every call site is monomorphic, and method calls lower to
+// direct (devirtualized) calls that LLVM can inline. The vtable pointer gives
+// objects a runtime class identity and is the dispatch path subclassing will
+// use when it lands.
+static constexpr unsigned kVTableSlots = 1;
+
+// Get or declare the llvm::Function for a dispatchable method so its address
+// can be taken before the method body has been generated. Mirrors the
+// mangling and signature construction in MethodDecl::codegen.
+static llvm::Function* getOrDeclareMethod(CodeGenContext& ctx,
+                                          const std::string& className,
+                                          const MethodDecl& method) {
+    std::string mangledName = className + "_" + method.name;
+
+    llvm::Function* func = ctx.getModule().getFunction(mangledName);
+    if (func) {
+        return func;
+    }
+
+    std::vector<llvm::Type*> paramTypes;
+    auto classType = TypeRegistry::instance().getClassType(className);
+    paramTypes.push_back(classType->toLLVMType(ctx.getContext()));
+    for (const auto& param : method.params) {
+        paramTypes.push_back(param.type->toLLVMType(ctx.getContext()));
+    }
+
+    llvm::FunctionType* funcType = llvm::FunctionType::get(
+        method.returnType->toLLVMType(ctx.getContext()),
+        paramTypes,
+        false
+    );
+
+    return llvm::Function::Create(funcType, llvm::Function::ExternalLinkage,
+                                  mangledName, ctx.getModule());
+}
+
+// Get or create the constant vtable global for a class. Named with a '.'
+// separator so it can never collide with a mangled method symbol.
+static llvm::GlobalVariable* getOrCreateVTable(CodeGenContext& ctx,
+                                               ClassDecl* classDecl) {
+    std::string vtableName = classDecl->getName() + ".vtable";
+
+    llvm::GlobalVariable* vtable = ctx.getModule().getNamedGlobal(vtableName);
+    if (vtable) {
+        return vtable;
+    }
+
+    llvm::PointerType* ptrType = llvm::PointerType::get(ctx.getContext(), 0);
+    std::vector<llvm::Constant*> slots;
+    for (const auto& method : classDecl->getMethods()) {
+        if (method.isConstructor) continue;
+        slots.push_back(getOrDeclareMethod(ctx, classDecl->getName(), method));
+    }
+
+    llvm::ArrayType* vtableType = llvm::ArrayType::get(ptrType, slots.size());
+    return new llvm::GlobalVariable(
+        ctx.getModule(), vtableType, /*isConstant=*/true,
+        llvm::GlobalValue::ExternalLinkage,
+        llvm::ConstantArray::get(vtableType, slots), vtableName);
+}
+
 // ===== Member Access Expression =====
 
 llvm::Value* MemberAccessExpr::codegen() {
@@ -42,7 +112,7 @@ llvm::Value* MemberAccessExpr::codegen() {
     // Check if object is 'this'
     if (dynamic_cast<ThisExpr*>(object.get())) {
         auto& named_values = ctx.getNamedValues();
-        llvm::AllocaInst* thisAlloca = named_values["this"];
+        llvm::AllocaInst* thisAlloca = named_values.lookup("this");
         if (!thisAlloca) {
             return logError("'this' not found in current context");
         }
@@ -101,10 +171,10 @@ llvm::Value* MemberAccessExpr::codegen() {
             return logError(("Failed to generate struct type for class: " + className).c_str());
         }
         
-        // GEP to get field pointer
+        // GEP to get field pointer (fields start after the vtable slot)
         llvm::Value* fieldPtr = ctx.getBuilder().CreateStructGEP(
-            structType, thisPtr, fieldIndex, member.c_str());
-        
+            structType, thisPtr, kVTableSlots + fieldIndex, member.c_str());
+
         // Load the field value
         return ctx.getBuilder().CreateLoad(field->type->toLLVMType(ctx.getContext()), 
                                            fieldPtr, member.c_str());
@@ -114,11 +184,11 @@ llvm::Value* MemberAccessExpr::codegen() {
         if (!objPtr) return nullptr;
         
         // Try to get the class type from the object
-        auto classType = std::dynamic_pointer_cast<ClassType>(object->getType());
+        auto classType = dynamic_cast<ClassType*>(object->getType());
         
         if (!classType) {
             if (auto* newExpr = dynamic_cast<NewExpr*>(object.get())) {
-                classType = std::dynamic_pointer_cast<ClassType>(newExpr->getType());
+                classType = dynamic_cast<ClassType*>(newExpr->getType());
             }
         }
         
@@ -126,7 +196,7 @@ llvm::Value* MemberAccessExpr::codegen() {
             if (auto* varExpr = dynamic_cast<VariableExpr*>(object.get())) {
                 auto varType = ctx.getVariableType(varExpr->getName());
                 if (varType) {
-                    classType = std::dynamic_pointer_cast<ClassType>(varType);
+                    classType = dynamic_cast<ClassType*>(varType);
                 }
             }
         }
@@ -186,9 +256,9 @@ llvm::Value* MemberAccessExpr::codegen() {
             return logError(("Failed to generate struct type for class: " + classType->getName()).c_str());
         }
         
-        // GEP to get field pointer
+        // GEP to get field pointer (fields start after the vtable slot)
         llvm::Value* fieldPtr = ctx.getBuilder().CreateStructGEP(
-            structType, objPtr, fieldIndex, member.c_str());
+            structType, objPtr, kVTableSlots + fieldIndex, member.c_str());
         
         // Load the field value
         return ctx.getBuilder().CreateLoad(field->type->toLLVMType(ctx.getContext()), 
@@ -198,13 +268,13 @@ llvm::Value* MemberAccessExpr::codegen() {
 
 // ===== Member Call Expression =====
 
-std::shared_ptr<Type> MemberCallExpr::getType() const {
+Type* MemberCallExpr::getType() const {
     // Try to resolve the actual return type dynamically
-    auto classType = std::dynamic_pointer_cast<ClassType>(object->getType());
+    auto classType = dynamic_cast<ClassType*>(object->getType());
     
     if (!classType) {
         if (auto* newExpr = dynamic_cast<NewExpr*>(object.get())) {
-            classType = std::dynamic_pointer_cast<ClassType>(newExpr->getType());
+            classType = dynamic_cast<ClassType*>(newExpr->getType());
         }
     }
     
@@ -213,7 +283,7 @@ std::shared_ptr<Type> MemberCallExpr::getType() const {
             auto& ctx = getGlobalContext();
             auto varType = ctx.getVariableType(varExpr->getName());
             if (varType) {
-                classType = std::dynamic_pointer_cast<ClassType>(varType);
+                classType = dynamic_cast<ClassType*>(varType);
             }
         }
     }
@@ -236,16 +306,28 @@ std::shared_ptr<Type> MemberCallExpr::getType() const {
 
 llvm::Value* MemberCallExpr::codegen() {
     auto& ctx = getGlobalContext();
-    
+
+    // Built-in methods on arrays lower to inline IR and runtime calls
+    // instead of class dispatch (see ArrayCodeGen.cpp)
+    Type* receiverType = object->getType();
+    if (auto* recvVar = dynamic_cast<VariableExpr*>(object.get())) {
+        if (Type* varType = ctx.getVariableType(recvVar->getName())) {
+            receiverType = varType;
+        }
+    }
+    if (dynamic_cast<ArrayType*>(receiverType)) {
+        return codegenArrayMemberCall(*this);
+    }
+
     llvm::Value* objPtr = object->codegen();
     if (!objPtr) return nullptr;
     
     // Try to get the class type
-    auto classType = std::dynamic_pointer_cast<ClassType>(object->getType());
+    auto classType = dynamic_cast<ClassType*>(object->getType());
     
     if (!classType) {
         if (auto* newExpr = dynamic_cast<NewExpr*>(object.get())) {
-            classType = std::dynamic_pointer_cast<ClassType>(newExpr->getType());
+            classType = dynamic_cast<ClassType*>(newExpr->getType());
         }
     }
     
@@ -253,7 +335,7 @@ llvm::Value* MemberCallExpr::codegen() {
         if (auto* varExpr = dynamic_cast<VariableExpr*>(object.get())) {
             auto varType = ctx.getVariableType(varExpr->getName());
             if (varType) {
-                classType = std::dynamic_pointer_cast<ClassType>(varType);
+                classType = dynamic_cast<ClassType*>(varType);
             }
         }
     }
@@ -299,7 +381,9 @@ llvm::Value* MemberCallExpr::codegen() {
         }
     }
     
-    // Look up the function
+    // Devirtualized call: with no subtyping the static type is the exact
+    // type, so we bypass the vtable and call the method directly, which
+    // keeps the call site inlinable
     std::string mangledName = classDecl->getName() + "_" + method;
     llvm::Function* func = ctx.getModule().getFunction(mangledName);
     if (!func) {
@@ -349,29 +433,45 @@ llvm::Value* NewExpr::codegen() {
         return logError(("Class not found: " + className).c_str());
     }
     
-    // Use aurora_object_create for proper ARC initialization
     llvm::Type* structType = classDecl->codegen();
-    llvm::Value* size = llvm::ConstantInt::get(
-        llvm::Type::getInt64Ty(ctx.getContext()),
-        ctx.getModule().getDataLayout().getTypeAllocSize(structType));
-    
-    // Get or create malloc function
-    llvm::Function* mallocFunc = ctx.getModule().getFunction("malloc");
-    if (!mallocFunc) {
-        llvm::FunctionType* mallocType = llvm::FunctionType::get(
-            llvm::PointerType::get(ctx.getContext(), 0),
-            {llvm::Type::getInt64Ty(ctx.getContext())},
-            false);
-        mallocFunc = llvm::Function::Create(mallocType, llvm::Function::ExternalLinkage,
-                                           "malloc", ctx.getModule());
+    llvm::Value* objPtr;
+
+    if (ctx.isStackAllocatable(this)) {
+        // Escape analysis proved this object never leaves the function,
+        // so it lives in an entry-block alloca: no allocator call, and
+        // an instance created in a loop reuses one stack slot (the
+        // vtable/field stores below reinitialize it each iteration)
+        llvm::Function* function = ctx.getBuilder().GetInsertBlock()->getParent();
+        objPtr = ctx.createEntryBlockAlloca(function, className + "_stack", structType);
+    } else {
+        llvm::Value* size = llvm::ConstantInt::get(
+            llvm::Type::getInt64Ty(ctx.getContext()),
+            ctx.getModule().getDataLayout().getTypeAllocSize(structType));
+
+        // Get or create malloc function
+        llvm::Function* mallocFunc = ctx.getModule().getFunction("malloc");
+        if (!mallocFunc) {
+            llvm::FunctionType* mallocType = llvm::FunctionType::get(
+                llvm::PointerType::get(ctx.getContext(), 0),
+                {llvm::Type::getInt64Ty(ctx.getContext())},
+                false);
+            mallocFunc = llvm::Function::Create(mallocType, llvm::Function::ExternalLinkage,
+                                               "malloc", ctx.getModule());
+        }
+
+        objPtr = ctx.getBuilder().CreateCall(mallocFunc, {size}, "newtmp");
     }
-    
-    llvm::Value* objPtr = ctx.getBuilder().CreateCall(mallocFunc, {size}, "newtmp");
-    
+
+    // Install the class vtable in slot 0
+    llvm::Value* vtablePtr = ctx.getBuilder().CreateStructGEP(
+        structType, objPtr, 0, "vtable_slot");
+    ctx.getBuilder().CreateStore(getOrCreateVTable(ctx, classDecl), vtablePtr);
+
     // Initialize fields to default values
     size_t fieldIndex = 0;
     for (const auto& field : classDecl->getFields()) {
-        llvm::Value* fieldPtr = ctx.getBuilder().CreateStructGEP(structType, objPtr, fieldIndex);
+        llvm::Value* fieldPtr = ctx.getBuilder().CreateStructGEP(
+            structType, objPtr, kVTableSlots + fieldIndex);
         if (field.initializer) {
             llvm::Value* initVal = field.initializer->codegen();
             ctx.getBuilder().CreateStore(initVal, fieldPtr);
@@ -384,7 +484,7 @@ llvm::Value* NewExpr::codegen() {
     }
     
     // Find the correct constructor based on argument types
-    std::vector<std::shared_ptr<Type>> argTypes;
+    std::vector<Type*> argTypes;
     for (const auto& arg : args) {
         argTypes.push_back(arg->getType());
     }
@@ -439,7 +539,7 @@ llvm::Value* ThisExpr::codegen() {
     auto& ctx = getGlobalContext();
     
     auto& named_values = ctx.getNamedValues();
-    llvm::AllocaInst* thisAlloca = named_values["this"];
+    llvm::AllocaInst* thisAlloca = named_values.lookup("this");
     
     if (!thisAlloca) {
         return logError("'this' used outside of method context");
@@ -459,8 +559,10 @@ llvm::Type* ClassDecl::codegen() {
         return structType;
     }
     
-    // Create struct type for the class
+    // Create struct type for the class: vtable pointer first, then the
+    // declared fields (see kVTableSlots)
     std::vector<llvm::Type*> fieldTypes;
+    fieldTypes.push_back(llvm::PointerType::get(ctx.getContext(), 0));
     for (const auto& field : fields) {
         fieldTypes.push_back(field.type->toLLVMType(ctx.getContext()));
     }
@@ -474,6 +576,9 @@ void ClassDecl::codegenMethods() {
     for (auto& method : methods) {
         method.codegen(name);
     }
+    // Emit the vtable even if this module never instantiates the class,
+    // so other modules can reference it as an external symbol
+    getOrCreateVTable(getGlobalContext(), this);
 }
 
 FieldDecl* ClassDecl::findField(const std::string& fieldName) {
@@ -495,12 +600,12 @@ MethodDecl* ClassDecl::findMethod(const std::string& methodName) {
 }
 
 MethodDecl* ClassDecl::findMethod(const std::string& methodName, 
-                                  const std::vector<std::shared_ptr<Type>>& paramTypes) {
+                                  const std::vector<Type*>& paramTypes) {
     for (auto& method : methods) {
         if (method.name == methodName && method.params.size() == paramTypes.size()) {
             bool match = true;
             for (size_t i = 0; i < paramTypes.size(); ++i) {
-                if (!method.params[i].type->equals(paramTypes[i].get())) {
+                if (!method.params[i].type->equals(paramTypes[i])) {
                     match = false;
                     break;
                 }
@@ -573,13 +678,15 @@ llvm::Function* MethodDecl::codegen(const std::string& className) {
     
     // Set up symbol table with parameters
     ctx.getNamedValues().clear();
-    
+    ctx.clearStaticArrayLengths();
+    ctx.setStackAllocatableNews(findStackAllocatableNews(body));
+
     argIt = func->arg_begin();
     // Store 'this' pointer
     llvm::AllocaInst* thisAlloca = ctx.createEntryBlockAlloca(
         func, "this", argIt->getType());
     ctx.getBuilder().CreateStore(&(*argIt), thisAlloca);
-    ctx.getNamedValues()["this"] = thisAlloca;
+    ctx.getNamedValues().insert("this", thisAlloca);
     ++argIt;
     
     // Store other parameters
@@ -587,7 +694,7 @@ llvm::Function* MethodDecl::codegen(const std::string& className) {
         llvm::AllocaInst* alloca = ctx.createEntryBlockAlloca(
             func, param.name, argIt->getType());
         ctx.getBuilder().CreateStore(&(*argIt), alloca);
-        ctx.getNamedValues()[param.name] = alloca;
+        ctx.getNamedValues().insert(param.name, alloca);
         
         // Store parameter type information for type checking
         ctx.setVariableType(param.name, param.type);
@@ -636,7 +743,7 @@ llvm::Value* assignToMemberField(MemberAccessExpr* memberAccess, llvm::Value* va
     // Check if object is 'this'
     if (dynamic_cast<ThisExpr*>(memberAccess->getObject())) {
         auto& named_values = ctx.getNamedValues();
-        llvm::AllocaInst* thisAlloca = named_values["this"];
+        llvm::AllocaInst* thisAlloca = named_values.lookup("this");
         if (!thisAlloca) {
             return logError("'this' not found in current context");
         }
@@ -681,7 +788,8 @@ llvm::Value* assignToMemberField(MemberAccessExpr* memberAccess, llvm::Value* va
         }
         
         llvm::Value* fieldPtr = ctx.getBuilder().CreateStructGEP(
-            structType, thisPtr, fieldIndex, memberAccess->getMember().c_str());
+            structType, thisPtr, kVTableSlots + fieldIndex,
+            memberAccess->getMember().c_str());
         
         ctx.getBuilder().CreateStore(val, fieldPtr);
         return val;
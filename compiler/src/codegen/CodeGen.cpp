@@ -1,11 +1,29 @@
+#include "aurora/AST.h"
 #include "aurora/CodeGen.h"
 #include "aurora/Logger.h"
+#include "aurora/Utils.h"
 #include "aurora_runtime.h"
+#include <llvm/ExecutionEngine/Orc/CompileUtils.h>
+#include <llvm/ExecutionEngine/Orc/JITTargetMachineBuilder.h>
 #include <llvm/ExecutionEngine/Orc/LLJIT.h>
 #include <llvm/Support/TargetSelect.h>
 #include <llvm/ExecutionEngine/Orc/ThreadSafeModule.h>
+#include <llvm/IR/LegacyPassManager.h>
 #include <llvm/IR/Verifier.h>
+#include <llvm/MC/TargetRegistry.h>
+#include <llvm/Passes/PassBuilder.h>
+#include <llvm/Support/MD5.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Target/TargetMachine.h>
+#include <llvm/TargetParser/Host.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <optional>
+#include <thread>
 
 namespace aurora {
 
@@ -64,18 +82,115 @@ LoopContext* CodeGenContext::getCurrentLoop() {
     return &loop_stack_.back();
 }
 
+const LoopContext* CodeGenContext::findCountedLoop(const std::string& var) const {
+    // Innermost first: an inner loop reusing the name shadows the outer
+    // binding, so the search stops at the first match either way
+    for (auto it = loop_stack_.rbegin(); it != loop_stack_.rend(); ++it) {
+        if (it->inductionVar == var) {
+            return it->counted ? &*it : nullptr;
+        }
+    }
+    return nullptr;
+}
+
+// ============================================================================
+// Array Bounds Checking
+// ============================================================================
+
+void CodeGenContext::setStaticArrayLength(const std::string& name, int64_t length) {
+    // Shifted by one: lookup() returns 0 for names with no entry
+    static_array_lengths_.insert(name, length + 1);
+}
+
+int64_t CodeGenContext::getStaticArrayLength(const std::string& name) const {
+    return static_array_lengths_.lookup(name) - 1;
+}
+
+void CodeGenContext::clearStaticArrayLengths() {
+    static_array_lengths_.clear();
+}
+
+bool CodeGenContext::arrayIndexProvablySafe(const Expr* array, const Expr* index) const {
+    // The array's length must be statically known
+    int64_t length = -1;
+    if (auto* literal = dynamic_cast<const ArrayLiteralExpr*>(array)) {
+        length = static_cast<int64_t>(literal->getElements().size());
+    } else if (auto* var = dynamic_cast<const VariableExpr*>(array)) {
+        length = getStaticArrayLength(var->getName());
+    }
+    if (length < 0) {
+        return false;
+    }
+
+    // Constant index: compare directly
+    if (auto* idx = dynamic_cast<const IntLiteralExpr*>(index)) {
+        return idx->getValue() >= 0 && idx->getValue() < length;
+    }
+
+    // Induction variable of an enclosing counted loop: safe when the
+    // whole iteration range fits inside the array
+    if (auto* idxVar = dynamic_cast<const VariableExpr*>(index)) {
+        const LoopContext* loop = findCountedLoop(idxVar->getName());
+        return loop && loop->constLower >= 0 && loop->constUpper <= length;
+    }
+
+    return false;
+}
+
+void CodeGenContext::insertArrayBoundsCheck(llvm::Value* arrayVal, llvm::Value* indexVal) {
+    llvm::Function* function = builder_->GetInsertBlock()->getParent();
+
+    llvm::Value* length = builder_->CreateExtractValue(arrayVal, 0, "array_len");
+    // One unsigned compare covers both ends: a negative index wraps to a
+    // huge unsigned value and fails the same test
+    llvm::Value* outOfBounds = builder_->CreateICmpUGE(indexVal, length, "idx_oob");
+
+    llvm::BasicBlock* fail_bb = llvm::BasicBlock::Create(*context_, "boundsfail", function);
+    llvm::BasicBlock* ok_bb = llvm::BasicBlock::Create(*context_, "boundsok", function);
+    builder_->CreateCondBr(outOfBounds, fail_bb, ok_bb);
+
+    builder_->SetInsertPoint(fail_bb);
+    llvm::Function* panicFunc = module_->getFunction("aurora_panic");
+    if (!panicFunc) {
+        llvm::FunctionType* panicType = llvm::FunctionType::get(
+            llvm::Type::getVoidTy(*context_),
+            {llvm::PointerType::get(*context_, 0)},
+            false);
+        panicFunc = llvm::Function::Create(panicType,
+            llvm::Function::ExternalLinkage,
+            "aurora_panic", *module_);
+        panicFunc->setDoesNotReturn();
+    }
+
+    llvm::GlobalVariable* message = module_->getNamedGlobal("aurora_oob_msg");
+    if (!message) {
+        message = builder_->CreateGlobalString(
+            "Array index out of bounds", "aurora_oob_msg");
+    }
+    builder_->CreateCall(panicFunc, {message});
+    builder_->CreateUnreachable();
+
+    builder_->SetInsertPoint(ok_bb);
+}
+
 // ============================================================================
 // Memory Management (ARC) Implementation
 // ============================================================================
 
 void CodeGenContext::pushScope() {
     scope_stack_.emplace_back();
+    scope_stack_.back().named_values_mark = named_values_.enterScope();
+    scope_stack_.back().variable_types_mark = variable_types_.enterScope();
+    scope_stack_.back().static_lengths_mark = static_array_lengths_.enterScope();
 }
 
 void CodeGenContext::popScope() {
     if (!scope_stack_.empty()) {
         // Note: releaseAllInScope() should be called manually before popScope
         // to control exactly where release instructions are inserted
+        named_values_.exitScope(scope_stack_.back().named_values_mark);
+        variable_types_.exitScope(scope_stack_.back().variable_types_mark);
+        static_array_lengths_.exitScope(scope_stack_.back().static_lengths_mark);
         scope_stack_.pop_back();
     }
 }
@@ -179,7 +294,35 @@ bool CodeGenContext::needsMemoryManagement(llvm::Type* type) {
     return type && type->isPointerTy();
 }
 
-void CodeGenContext::pushFunctionReturnType(std::shared_ptr<Type> type) {
+llvm::Constant* CodeGenContext::getOrCreateInternedString(const std::string& value) {
+    auto it = interned_strings_.find(value);
+    if (it != interned_strings_.end()) {
+        return it->second;
+    }
+
+    // Lay out a complete AuroraString as constant data, matching the
+    // runtime struct: {ref_count, type, flags}, length, bytes + NUL.
+    // The immortal flag makes retain/release/mark-shared no-ops, so the
+    // global can live in read-only memory and be shared freely.
+    auto& llctx = getContext();
+    llvm::Constant* fields[] = {
+        llvm::ConstantInt::get(llvm::Type::getInt64Ty(llctx), 1),  // ref_count (pinned)
+        llvm::ConstantInt::get(llvm::Type::getInt32Ty(llctx), AURORA_TYPE_STRING),
+        llvm::ConstantInt::get(llvm::Type::getInt32Ty(llctx), AURORA_RC_FLAG_IMMORTAL),
+        llvm::ConstantInt::get(llvm::Type::getInt64Ty(llctx),
+                               static_cast<int64_t>(value.size())),
+        llvm::ConstantDataArray::getString(llctx, value, true),
+    };
+    llvm::Constant* init = llvm::ConstantStruct::getAnon(llctx, fields);
+
+    auto* global = new llvm::GlobalVariable(
+        getModule(), init->getType(), /*isConstant=*/true,
+        llvm::GlobalValue::PrivateLinkage, init, ".str.intern");
+    interned_strings_[value] = global;
+    return global;
+}
+
+void CodeGenContext::pushFunctionReturnType(Type* type) {
     function_return_stack_.push_back(std::move(type));
 }
 
@@ -189,13 +332,387 @@ void CodeGenContext::popFunctionReturnType() {
     }
 }
 
-std::shared_ptr<Type> CodeGenContext::currentFunctionReturnType() const {
+Type* CodeGenContext::currentFunctionReturnType() const {
     if (function_return_stack_.empty()) {
         return nullptr;
     }
     return function_return_stack_.back();
 }
 
+/// Elide provably-paired retain/release calls within a basic block.
+/// A retain whose only use is a later release of the same pointer, with
+/// no intervening calls or stores (which could hide another release of
+/// the object or let the pointer escape), is a net no-op: the caller
+/// already held a reference across the whole range. Returns the number
+/// of pairs removed.
+static unsigned elideRetainReleasePairs(llvm::Function& func) {
+    unsigned elided = 0;
+
+    for (auto& block : func) {
+        llvm::CallInst* retain = nullptr;
+
+        for (auto inst = block.begin(); inst != block.end();) {
+            llvm::Instruction* current = &*inst++;
+
+            if (auto* call = llvm::dyn_cast<llvm::CallInst>(current)) {
+                llvm::Function* callee = call->getCalledFunction();
+                if (callee && callee->getName() == "aurora_retain") {
+                    retain = call;
+                    continue;
+                }
+                if (retain && callee && callee->getName() == "aurora_release") {
+                    llvm::Value* released = call->getArgOperand(0);
+                    bool matches = released == retain ||
+                                   released == retain->getArgOperand(0);
+                    // The retain result must feed only this release (or
+                    // nothing, when the release uses the original pointer)
+                    bool resultConfined =
+                        retain->use_empty() ||
+                        (retain->hasOneUse() && *retain->user_begin() == call);
+                    if (matches && resultConfined) {
+                        retain->replaceAllUsesWith(retain->getArgOperand(0));
+                        retain->eraseFromParent();
+                        call->eraseFromParent();
+                        retain = nullptr;
+                        ++elided;
+                        continue;
+                    }
+                }
+                // Any other call may release or publish the object
+                retain = nullptr;
+            } else if (llvm::isa<llvm::StoreInst>(current)) {
+                // A store can stash the pointer for a later release path
+                retain = nullptr;
+            }
+        }
+    }
+
+    return elided;
+}
+
+void CodeGenContext::optimizeModule() {
+    auto& logger = Logger::instance();
+
+    if (arc_opt_enabled_) {
+        unsigned elided = 0;
+        for (auto& func : *module_) {
+            elided += elideRetainReleasePairs(func);
+        }
+        if (elided > 0) {
+            logger.debug("Elided " + std::to_string(elided) + " retain/release pair(s)", "Codegen");
+        }
+    }
+
+    if (opt_level_ <= 0) {
+        logger.debug("Optimization disabled (-O0)", "Codegen");
+        return;
+    }
+
+    llvm::OptimizationLevel level;
+    switch (opt_level_) {
+        case 1: level = llvm::OptimizationLevel::O1; break;
+        case 2: level = llvm::OptimizationLevel::O2; break;
+        default: level = llvm::OptimizationLevel::O3; break;
+    }
+
+    logger.phaseStart("Optimization");
+    logger.debug("Running -O" + std::to_string(opt_level_) + " pipeline", "Codegen");
+
+    // Standard new-pass-manager setup: analysis managers + default
+    // per-module pipeline (inlining, mem2reg/SROA, GVN, loop opts, ...)
+    llvm::LoopAnalysisManager lam;
+    llvm::FunctionAnalysisManager fam;
+    llvm::CGSCCAnalysisManager cgam;
+    llvm::ModuleAnalysisManager mam;
+
+    llvm::PassBuilder pass_builder;
+    pass_builder.registerModuleAnalyses(mam);
+    pass_builder.registerCGSCCAnalyses(cgam);
+    pass_builder.registerFunctionAnalyses(fam);
+    pass_builder.registerLoopAnalyses(lam);
+    pass_builder.crossRegisterProxies(lam, fam, cgam, mam);
+
+    llvm::ModulePassManager mpm = pass_builder.buildPerModuleDefaultPipeline(level);
+    mpm.run(*module_, mam);
+
+    logger.phaseEnd("Optimization");
+}
+
+// ============================================================================
+// Target Selection
+// ============================================================================
+
+static llvm::CodeGenOptLevel codeGenOptLevelFor(int opt_level) {
+    switch (opt_level) {
+        case 0: return llvm::CodeGenOptLevel::None;
+        case 1: return llvm::CodeGenOptLevel::Less;
+        case 2: return llvm::CodeGenOptLevel::Default;
+        default: return llvm::CodeGenOptLevel::Aggressive;
+    }
+}
+
+// Resolve the -mcpu setting to a concrete CPU name and feature string.
+// "native" (the default) detects the host CPU and every feature it
+// reports, so the JIT and AOT backends can actually select AVX2/AVX-512
+// instructions on machines that have them; an explicit CPU name is
+// passed through with no extra features for reproducible output.
+static std::pair<std::string, std::string> resolveTargetCPU(const std::string& setting) {
+    if (!setting.empty() && setting != "native") {
+        return {setting, ""};
+    }
+
+    auto host = llvm::orc::JITTargetMachineBuilder::detectHost();
+    if (!host) {
+        llvm::consumeError(host.takeError());
+        return {"generic", ""};
+    }
+    return {host->getCPU(), host->getFeatures().getString()};
+}
+
+// Worker threads for ORC's IR-to-machine-code stage. All Aurora modules
+// lower into the one shared llvm::Module (cross-module calls resolve
+// through the shared function table), so AST lowering itself stays
+// serial - but the backend half of codegen parallelizes: lazy mode
+// partitions the module per function and materializes concurrently
+// across the pool, and eager mode at least compiles off the calling
+// thread. Returns 0 (inline compilation) on single-core machines.
+static unsigned compileThreadCount() {
+    unsigned n = std::thread::hardware_concurrency();
+    return n > 1 ? n : 0;
+}
+
+bool CodeGenContext::emitObjectFile(const std::string& path) {
+    auto& logger = Logger::instance();
+
+    llvm::InitializeNativeTarget();
+    llvm::InitializeNativeTargetAsmPrinter();
+    llvm::InitializeNativeTargetAsmParser();
+
+    std::string triple = llvm::sys::getDefaultTargetTriple();
+    std::string error;
+    const llvm::Target* target = llvm::TargetRegistry::lookupTarget(triple, error);
+    if (!target) {
+        logger.error("Failed to look up target '" + triple + "': " + error);
+        return false;
+    }
+
+    llvm::CodeGenOptLevel cg_level = codeGenOptLevelFor(opt_level_);
+
+    auto [cpu, features] = resolveTargetCPU(target_cpu_);
+    logger.debug("Target CPU: " + cpu, "Codegen");
+
+    llvm::TargetOptions options;
+    std::unique_ptr<llvm::TargetMachine> target_machine(target->createTargetMachine(
+        triple, cpu, features, options, llvm::Reloc::PIC_, std::nullopt, cg_level));
+    if (!target_machine) {
+        logger.error("Failed to create target machine for: " + triple);
+        return false;
+    }
+
+    module_->setDataLayout(target_machine->createDataLayout());
+
+    std::error_code ec;
+    llvm::raw_fd_ostream dest(path, ec, llvm::sys::fs::OF_None);
+    if (ec) {
+        logger.error("Could not open object file " + path + ": " + ec.message());
+        return false;
+    }
+
+    logger.phaseStart("Object emission");
+    llvm::legacy::PassManager pass;
+    if (target_machine->addPassesToEmitFile(pass, dest, nullptr,
+                                            llvm::CodeGenFileType::ObjectFile)) {
+        logger.error("Target machine cannot emit object files for: " + triple);
+        return false;
+    }
+    pass.run(*module_);
+    dest.flush();
+    logger.phaseEnd("Object emission");
+
+    logger.info("Generated object file: " + path);
+    return true;
+}
+
+bool CodeGenContext::emitExecutable(const std::string& path) {
+    auto& logger = Logger::instance();
+
+    std::string obj_path = path + ".o";
+    if (!emitObjectFile(obj_path)) {
+        return false;
+    }
+
+    // Link with the system compiler driver so the platform C/C++ startup
+    // files and libraries come in for free. The runtime/stdlib archives
+    // live in <sysroot>/lib after install, or in the build tree during
+    // development.
+    std::string sysroot = getSysroot();
+    std::string cmd = "c++ -o \"" + path + "\" \"" + obj_path + "\"";
+    for (const char* rel : {"/lib", "/build/stdlib", "/build/runtime"}) {
+        std::string dir = sysroot + rel;
+        if (std::filesystem::exists(dir)) {
+            cmd += " -L\"" + dir + "\"";
+        }
+    }
+    cmd += " -laurora_stdlib -laurora_runtime";
+
+    logger.phaseStart("Linking");
+    logger.debug("Link command: " + cmd, "Codegen");
+    int rc = std::system(cmd.c_str());
+    std::remove(obj_path.c_str());
+    logger.phaseEnd("Linking", rc == 0);
+
+    if (rc != 0) {
+        logger.error("Linker failed with exit code " + std::to_string(rc));
+        return false;
+    }
+    logger.info("Generated executable: " + path);
+    return true;
+}
+
+// ============================================================================
+// Profile-Guided JIT
+// ============================================================================
+
+// Bump when the profile file format changes
+static constexpr const char* kProfileFormatVersion = "1";
+
+// Entry counts at or above this mark a function hot on the next run
+static constexpr uint64_t kHotFunctionThreshold = 512;
+
+// Prefix of the exported per-function counter globals
+static constexpr const char* kProfileCounterPrefix = "__aurora_profcnt_";
+
+static std::string profileCacheDir() {
+    const char* env_dir = std::getenv("AURORA_CACHE_DIR");
+    if (env_dir && env_dir[0] != '\0') {
+        return env_dir;
+    }
+    const char* home = std::getenv("HOME");
+    if (home && home[0] != '\0') {
+        return std::string(home) + "/.cache/aurora";
+    }
+    return "";
+}
+
+// Profiles are keyed by the set of functions the program defines, so a
+// program finds its own counts again across runs while unrelated
+// programs sharing the cache directory stay apart
+static std::string profileFileFor(llvm::Module& module) {
+    std::string dir = profileCacheDir();
+    if (dir.empty()) {
+        return "";
+    }
+
+    std::vector<std::string> names;
+    for (auto& func : module) {
+        if (!func.isDeclaration()) {
+            names.push_back(std::string(func.getName()));
+        }
+    }
+    std::sort(names.begin(), names.end());
+
+    llvm::MD5 md5;
+    for (const auto& name : names) {
+        md5.update(name);
+    }
+    md5.update(kProfileFormatVersion);
+    llvm::MD5::MD5Result result;
+    md5.final(result);
+    llvm::SmallString<32> hex;
+    llvm::MD5::stringifyResult(result, hex);
+
+    std::error_code ec;
+    std::filesystem::create_directories(dir, ec);
+    return dir + "/aurora-profile-" + std::string(hex.str()) + ".prof";
+}
+
+static std::map<std::string, uint64_t> loadProfile(const std::string& path) {
+    std::map<std::string, uint64_t> counts;
+    std::ifstream in(path);
+    if (!in.is_open()) {
+        return counts;
+    }
+    std::string header;
+    std::getline(in, header);
+    if (header != std::string("AURORA-PROFILE ") + kProfileFormatVersion) {
+        return counts;
+    }
+    uint64_t count;
+    std::string name;
+    while (in >> count >> name) {
+        counts[name] = count;
+    }
+    return counts;
+}
+
+static void saveProfile(const std::string& path,
+                        const std::map<std::string, uint64_t>& counts) {
+    std::ofstream out(path, std::ios::trunc);
+    if (!out.is_open()) {
+        Logger::instance().warning("Cannot write JIT profile: " + path);
+        return;
+    }
+    out << "AURORA-PROFILE " << kProfileFormatVersion << "\n";
+    size_t hot = 0;
+    for (const auto& [name, count] : counts) {
+        out << count << ' ' << name << '\n';
+        if (count >= kHotFunctionThreshold) {
+            hot++;
+        }
+    }
+    Logger::instance().debug("Saved JIT profile (" + std::to_string(counts.size()) +
+                             " functions, " + std::to_string(hot) + " hot): " + path,
+                             "Codegen");
+}
+
+// Feed the previous run's counts back in before the pass pipeline:
+// functions the program actually leaned on get inlinehint/hot so the
+// inliner and block placement favor them, and functions that never ran
+// get cold so they stop polluting the hot path's code layout
+static void applyProfile(llvm::Module& module,
+                         const std::map<std::string, uint64_t>& counts) {
+    for (auto& func : module) {
+        if (func.isDeclaration()) {
+            continue;
+        }
+        auto it = counts.find(std::string(func.getName()));
+        if (it == counts.end()) {
+            continue;
+        }
+        if (it->second == 0) {
+            func.addFnAttr(llvm::Attribute::Cold);
+        } else if (it->second >= kHotFunctionThreshold) {
+            func.addFnAttr(llvm::Attribute::Hot);
+            func.addFnAttr(llvm::Attribute::InlineHint);
+        }
+    }
+}
+
+// Add an entry counter to every defined function. Runs after the pass
+// pipeline so the counters neither block inlining nor get folded away -
+// what survives optimization is exactly what the next run can tune.
+// The cost per call is one non-atomic load/add/store.
+static std::vector<std::string> instrumentEntryCounters(llvm::Module& module) {
+    std::vector<std::string> instrumented;
+    auto& llctx = module.getContext();
+    for (auto& func : module) {
+        if (func.isDeclaration()) {
+            continue;
+        }
+        auto* counter = new llvm::GlobalVariable(
+            module, llvm::Type::getInt64Ty(llctx), false,
+            llvm::GlobalValue::ExternalLinkage,
+            llvm::ConstantInt::get(llvm::Type::getInt64Ty(llctx), 0),
+            kProfileCounterPrefix + std::string(func.getName()));
+        llvm::IRBuilder<> builder(&func.getEntryBlock(),
+                                  func.getEntryBlock().begin());
+        llvm::Value* loaded = builder.CreateLoad(builder.getInt64Ty(), counter, "profcnt");
+        builder.CreateStore(builder.CreateAdd(loaded, builder.getInt64(1)), counter);
+        instrumented.push_back(std::string(func.getName()));
+    }
+    return instrumented;
+}
+
 void CodeGenContext::initializeJIT() {
     llvm::InitializeNativeTarget();
     llvm::InitializeNativeTargetAsmPrinter();
@@ -213,12 +730,77 @@ void CodeGenContext::initializeJIT() {
         }
     }
     
-    auto jit_expected = llvm::orc::LLJITBuilder().create();
-    if (!jit_expected) {
-        llvm::errs() << "Failed to create JIT: " << llvm::toString(jit_expected.takeError()) << "\n";
-        return;
+    // Target the host CPU and its features (or the -mcpu override) so
+    // instruction selection and vector width match the machine we are
+    // actually running on instead of a generic baseline
+    std::optional<llvm::orc::JITTargetMachineBuilder> jtmb;
+    if (auto detected = llvm::orc::JITTargetMachineBuilder::detectHost()) {
+        jtmb = std::move(*detected);
+        if (!target_cpu_.empty() && target_cpu_ != "native") {
+            jtmb->setCPU(target_cpu_);
+            jtmb->getFeatures() = llvm::SubtargetFeatures();
+        }
+        jtmb->setCodeGenOptLevel(codeGenOptLevelFor(opt_level_));
+        Logger::instance().debug("JIT target CPU: " +
+            (jtmb->getCPU().empty() ? std::string("generic") : jtmb->getCPU()),
+            "Codegen");
+    } else {
+        llvm::consumeError(detected.takeError());
+        Logger::instance().warning("Host target detection failed; JIT uses generic target");
+    }
+
+    if (lazy_jit_) {
+        // Lazy mode: functions are materialized through lazy call-through
+        // stubs on first call, so startup only compiles what actually runs.
+        // The per-module object cache is bypassed here - lazy partitions
+        // are per-function and would fragment it.
+        Logger::instance().debug("Using lazy per-function JIT", "Codegen");
+        llvm::orc::LLLazyJITBuilder lazy_builder;
+        lazy_builder.setNumCompileThreads(compileThreadCount());
+        if (jtmb) {
+            lazy_builder.setJITTargetMachineBuilder(*jtmb);
+        }
+        auto lazy_expected = lazy_builder.create();
+        if (!lazy_expected) {
+            llvm::errs() << "Failed to create lazy JIT: "
+                         << llvm::toString(lazy_expected.takeError()) << "\n";
+            return;
+        }
+        jit_ = std::move(*lazy_expected);
+    } else {
+        llvm::orc::LLJITBuilder jit_builder;
+        jit_builder.setNumCompileThreads(compileThreadCount());
+        if (jtmb) {
+            jit_builder.setJITTargetMachineBuilder(std::move(*jtmb));
+        }
+
+        // Route compilation through the persistent object cache so repeated
+        // runs of identical modules reuse machine code from disk
+        if (jit_cache_enabled_) {
+            if (!object_cache_) {
+                object_cache_ = std::make_unique<AuroraObjectCache>();
+            }
+            if (object_cache_->isEnabled()) {
+                auto* cache = object_cache_.get();
+                jit_builder.setCompileFunctionCreator(
+                    [cache](llvm::orc::JITTargetMachineBuilder jtmb)
+                        -> llvm::Expected<std::unique_ptr<llvm::orc::IRCompileLayer::IRCompiler>> {
+                        // TargetMachine is not thread-safe, so with a
+                        // compile pool each job builds its own; the cache
+                        // hook behaves exactly as before
+                        return std::make_unique<llvm::orc::ConcurrentIRCompiler>(
+                            std::move(jtmb), cache);
+                    });
+            }
+        }
+
+        auto jit_expected = jit_builder.create();
+        if (!jit_expected) {
+            llvm::errs() << "Failed to create JIT: " << llvm::toString(jit_expected.takeError()) << "\n";
+            return;
+        }
+        jit_ = std::move(*jit_expected);
     }
-    jit_ = std::move(*jit_expected);
     
     // Add runtime function symbols to JIT
     llvm::orc::MangleAndInterner mangle(jit_->getExecutionSession(), jit_->getDataLayout());
@@ -235,8 +817,14 @@ void CodeGenContext::initializeJIT() {
         {llvm::orc::ExecutorAddr::fromPtr(&aurora_array_get_ptr), llvm::JITSymbolFlags::Exported};
     runtime_symbols[mangle("aurora_array_set")] = 
         {llvm::orc::ExecutorAddr::fromPtr(&aurora_array_set), llvm::JITSymbolFlags::Exported};
-    runtime_symbols[mangle("aurora_array_bounds_check")] = 
+    runtime_symbols[mangle("aurora_array_bounds_check")] =
         {llvm::orc::ExecutorAddr::fromPtr(&aurora_array_bounds_check), llvm::JITSymbolFlags::Exported};
+    runtime_symbols[mangle("aurora_array_append")] =
+        {llvm::orc::ExecutorAddr::fromPtr(&aurora_array_append), llvm::JITSymbolFlags::Exported};
+    runtime_symbols[mangle("aurora_array_reserve")] =
+        {llvm::orc::ExecutorAddr::fromPtr(&aurora_array_reserve), llvm::JITSymbolFlags::Exported};
+    runtime_symbols[mangle("aurora_array_shrink_to_fit")] =
+        {llvm::orc::ExecutorAddr::fromPtr(&aurora_array_shrink_to_fit), llvm::JITSymbolFlags::Exported};
     
     // Add object runtime functions
     runtime_symbols[mangle("aurora_object_create")] = 
@@ -245,12 +833,28 @@ void CodeGenContext::initializeJIT() {
         {llvm::orc::ExecutorAddr::fromPtr(&aurora_object_free), llvm::JITSymbolFlags::Exported};
     
     // Add string runtime functions
-    runtime_symbols[mangle("aurora_string_create")] = 
+    runtime_symbols[mangle("aurora_string_create")] =
         {llvm::orc::ExecutorAddr::fromPtr(&aurora_string_create), llvm::JITSymbolFlags::Exported};
+    runtime_symbols[mangle("aurora_string_create_len")] =
+        {llvm::orc::ExecutorAddr::fromPtr(&aurora_string_create_len), llvm::JITSymbolFlags::Exported};
     runtime_symbols[mangle("aurora_string_free")] = 
         {llvm::orc::ExecutorAddr::fromPtr(&aurora_string_free), llvm::JITSymbolFlags::Exported};
-    runtime_symbols[mangle("aurora_string_length")] = 
+    runtime_symbols[mangle("aurora_string_length")] =
         {llvm::orc::ExecutorAddr::fromPtr(&aurora_string_length), llvm::JITSymbolFlags::Exported};
+    runtime_symbols[mangle("aurora_string_hash")] =
+        {llvm::orc::ExecutorAddr::fromPtr(&aurora_string_hash), llvm::JITSymbolFlags::Exported};
+
+    // Add string builder runtime functions
+    runtime_symbols[mangle("aurora_string_builder_create")] =
+        {llvm::orc::ExecutorAddr::fromPtr(&aurora_string_builder_create), llvm::JITSymbolFlags::Exported};
+    runtime_symbols[mangle("aurora_string_builder_append")] =
+        {llvm::orc::ExecutorAddr::fromPtr(&aurora_string_builder_append), llvm::JITSymbolFlags::Exported};
+    runtime_symbols[mangle("aurora_string_builder_append_bytes")] =
+        {llvm::orc::ExecutorAddr::fromPtr(&aurora_string_builder_append_bytes), llvm::JITSymbolFlags::Exported};
+    runtime_symbols[mangle("aurora_string_builder_finish")] =
+        {llvm::orc::ExecutorAddr::fromPtr(&aurora_string_builder_finish), llvm::JITSymbolFlags::Exported};
+    runtime_symbols[mangle("aurora_string_builder_free")] =
+        {llvm::orc::ExecutorAddr::fromPtr(&aurora_string_builder_free), llvm::JITSymbolFlags::Exported};
     
     // Add debug functions
     runtime_symbols[mangle("aurora_assert")] = 
@@ -264,9 +868,32 @@ void CodeGenContext::initializeJIT() {
         llvm::errs() << "Failed to add runtime symbols: " << llvm::toString(std::move(err)) << "\n";
     }
     
+    // Feed the last run's profile (if any) into the module before the
+    // pass pipeline sees it
+    if (pgo_jit_) {
+        profile_path_ = profileFileFor(*module_);
+        auto profile_counts = loadProfile(profile_path_);
+        if (!profile_counts.empty()) {
+            applyProfile(*module_, profile_counts);
+            Logger::instance().debug("Applied JIT profile: " + profile_path_, "Codegen");
+        }
+    }
+
+    // Optimize the module before handing it to the JIT
+    optimizeModule();
+
+    if (pgo_jit_) {
+        profiled_functions_ = instrumentEntryCounters(*module_);
+    }
+
     // Add the module
     auto tsm = llvm::orc::ThreadSafeModule(std::move(module_), std::move(context_));
-    if (auto err = jit_->addIRModule(std::move(tsm))) {
+    if (lazy_jit_) {
+        auto* lazy = static_cast<llvm::orc::LLLazyJIT*>(jit_.get());
+        if (auto err = lazy->addLazyIRModule(std::move(tsm))) {
+            llvm::errs() << "Failed to add module: " << llvm::toString(std::move(err)) << "\n";
+        }
+    } else if (auto err = jit_->addIRModule(std::move(tsm))) {
         llvm::errs() << "Failed to add module: " << llvm::toString(std::move(err)) << "\n";
     }
 }
@@ -315,9 +942,24 @@ int CodeGenContext::runMain() {
             return -1;
     }
     
+    // Persist this run's entry counts so the next compile of the same
+    // program can tier its hot functions up
+    if (pgo_jit_ && !profiled_functions_.empty() && !profile_path_.empty()) {
+        std::map<std::string, uint64_t> counts;
+        for (const auto& name : profiled_functions_) {
+            auto sym = jit_->lookup(kProfileCounterPrefix + name);
+            if (!sym) {
+                llvm::consumeError(sym.takeError());
+                continue;
+            }
+            counts[name] = *sym->toPtr<uint64_t*>();
+        }
+        saveProfile(profile_path_, counts);
+    }
+
     // Clean up JIT before returning to avoid destructor issues
     jit_.reset();
-    
+
     return exit_code;
 }
 
@@ -0,0 +1,269 @@
+#include "aurora/EscapeAnalysis.h"
+#include "aurora/Type.h"
+#include <map>
+#include <string>
+
+namespace aurora {
+
+namespace {
+
+// ===== Escape Scanner =====
+
+// Walks a statement list and records, for a set of candidate variables,
+// whether any use lets the bound object leave the function. The scanner
+// is purely syntactic: every expression position is either explicitly
+// sanctioned (field access base, method-call receiver, plain rebinding
+// target) or counts as an escape. `this` inside method bodies is
+// tracked under the reserved name "this" so the same walk doubles as
+// the per-class "does any method leak its receiver" summary.
+class EscapeScanner {
+public:
+    struct Candidate {
+        const NewExpr* def;       // defining initializer (null for "this")
+        std::string className;
+    };
+
+    std::map<std::string, Candidate> candidates;
+
+    void scanStmts(const std::vector<std::unique_ptr<Stmt>>& stmts) {
+        for (const auto& stmt : stmts) {
+            scanStmt(stmt.get());
+        }
+    }
+
+    bool escaped(const std::string& name) const {
+        return escaped_.count(name) != 0;
+    }
+
+private:
+    std::set<std::string> escaped_;
+
+    void escape(const std::string& name) {
+        if (candidates.count(name)) {
+            escaped_.insert(name);
+        }
+    }
+
+    // True when every method of the class keeps its receiver to itself:
+    // `this` is only ever used as a field-access base or as the receiver
+    // of another method call. Summaries are cached per class; the entry
+    // is seeded optimistically so self-referential classes terminate
+    // (every method body still gets scanned, so a real leak anywhere in
+    // the class flips the final answer).
+    bool classKeepsThis(const std::string& className) {
+        auto cached = class_summaries_.find(className);
+        if (cached != class_summaries_.end()) {
+            return cached->second;
+        }
+
+        auto classType = TypeRegistry::instance().getClassType(className);
+        ClassDecl* decl = classType ? classType->getDecl() : nullptr;
+        if (!decl) {
+            class_summaries_[className] = false;
+            return false;
+        }
+
+        class_summaries_[className] = true;
+        EscapeScanner methodScan;
+        methodScan.class_summaries_ = class_summaries_;
+        methodScan.candidates["this"] = {nullptr, className};
+        for (const auto& method : decl->getMethods()) {
+            methodScan.scanStmts(method.body);
+        }
+
+        bool clean = !methodScan.escaped("this");
+        class_summaries_[className] = clean;
+        return clean;
+    }
+
+    std::map<std::string, bool> class_summaries_;
+
+    void scanStmt(const Stmt* stmt) {
+        if (!stmt) return;
+
+        if (auto* ret = dynamic_cast<const ReturnStmt*>(stmt)) {
+            scanExpr(ret->getValue());
+        } else if (auto* exprStmt = dynamic_cast<const ExprStmt*>(stmt)) {
+            scanExpr(exprStmt->getExpr());
+        } else if (auto* varDecl = dynamic_cast<const VarDeclStmt*>(stmt)) {
+            auto it = candidates.find(varDecl->getName());
+            if (it != candidates.end() && it->second.def == varDecl->getInit()) {
+                // The defining declaration itself: only the constructor
+                // arguments can carry other candidates out
+                for (const auto& arg : it->second.def->getArgs()) {
+                    scanExpr(arg.get());
+                }
+            } else {
+                scanExpr(varDecl->getInit());
+            }
+        } else if (auto* ifStmt = dynamic_cast<const IfStmt*>(stmt)) {
+            scanExpr(ifStmt->getCondition());
+            scanStmts(ifStmt->getThenBranch());
+            scanStmts(ifStmt->getElseBranch());
+        } else if (auto* match = dynamic_cast<const MatchStmt*>(stmt)) {
+            scanExpr(match->getSubject());
+            for (const auto& arm : match->getArms()) {
+                for (const auto& pattern : arm.patterns) {
+                    scanExpr(pattern.get());
+                }
+                scanStmts(arm.body);
+            }
+            scanStmts(match->getDefaultBody());
+        } else if (auto* whileStmt = dynamic_cast<const WhileStmt*>(stmt)) {
+            scanExpr(whileStmt->getCondition());
+            scanStmts(whileStmt->getBody());
+        } else if (auto* forStmt = dynamic_cast<const ForStmt*>(stmt)) {
+            scanExpr(forStmt->getStartExpr());
+            scanExpr(forStmt->getEndExpr());
+            scanExpr(forStmt->getStepExpr());
+            scanStmts(forStmt->getBody());
+        } else if (auto* loop = dynamic_cast<const LoopStmt*>(stmt)) {
+            scanStmts(loop->getBody());
+        } else if (auto* assign = dynamic_cast<const AssignStmt*>(stmt)) {
+            // Rebinding the candidate variable itself is fine (the old
+            // object just dies); writing INTO a candidate via obj.field
+            // is covered by the member-access base rule below
+            if (!dynamic_cast<const VariableExpr*>(assign->getTarget())) {
+                scanExpr(assign->getTarget());
+            }
+            scanExpr(assign->getValue());
+        }
+        // Break/Continue carry no expressions
+    }
+
+    void scanExpr(const Expr* expr) {
+        if (!expr) return;
+
+        if (auto* var = dynamic_cast<const VariableExpr*>(expr)) {
+            // A bare use in an unsanctioned position: the pointer flows
+            // somewhere the analysis does not follow
+            escape(var->getName());
+        } else if (dynamic_cast<const ThisExpr*>(expr)) {
+            escape("this");
+        } else if (auto* bin = dynamic_cast<const BinaryExpr*>(expr)) {
+            scanExpr(bin->getLeft());
+            scanExpr(bin->getRight());
+        } else if (auto* unary = dynamic_cast<const UnaryExpr*>(expr)) {
+            scanExpr(unary->getExpr());
+        } else if (auto* arr = dynamic_cast<const ArrayLiteralExpr*>(expr)) {
+            for (const auto& elem : arr->getElements()) {
+                scanExpr(elem.get());
+            }
+        } else if (auto* index = dynamic_cast<const ArrayIndexExpr*>(expr)) {
+            scanExpr(index->getArray());
+            scanExpr(index->getIndex());
+        } else if (auto* ternary = dynamic_cast<const TernaryExpr*>(expr)) {
+            scanExpr(ternary->getCondition());
+            scanExpr(ternary->getTrueExpr());
+            scanExpr(ternary->getFalseExpr());
+        } else if (auto* safeNav = dynamic_cast<const SafeNavigationExpr*>(expr)) {
+            scanBase(safeNav->getObject());
+        } else if (auto* unwrap = dynamic_cast<const ForceUnwrapExpr*>(expr)) {
+            scanExpr(unwrap->getExpr());
+        } else if (auto* call = dynamic_cast<const CallExpr*>(expr)) {
+            for (const auto& arg : call->getArgs()) {
+                scanExpr(arg.get());
+            }
+        } else if (auto* nullCheck = dynamic_cast<const NullCheckExpr*>(expr)) {
+            scanExpr(nullCheck->getExpr());
+        } else if (auto* member = dynamic_cast<const MemberAccessExpr*>(expr)) {
+            scanBase(member->getObject());
+        } else if (auto* methodCall = dynamic_cast<const MemberCallExpr*>(expr)) {
+            scanReceiver(methodCall->getObject());
+            for (const auto& arg : methodCall->getArgs()) {
+                scanExpr(arg.get());
+            }
+        } else if (auto* newExpr = dynamic_cast<const NewExpr*>(expr)) {
+            for (const auto& arg : newExpr->getArgs()) {
+                scanExpr(arg.get());
+            }
+        }
+        // Literals carry no variable uses; any node type not listed has
+        // none either (the lists above are kept in sync with AST.h)
+    }
+
+    // Field access base: reading or writing obj.field never moves the
+    // object pointer itself
+    void scanBase(const Expr* base) {
+        if (dynamic_cast<const VariableExpr*>(base)) return;
+        if (dynamic_cast<const ThisExpr*>(base)) return;
+        scanExpr(base);
+    }
+
+    // Method-call receiver: calls are devirtualized, so the callee body
+    // is known statically. The receiver stays local as long as no
+    // method of its class lets `this` escape; inside a class scan the
+    // receiver `this` is covered by scanning every method of that class.
+    void scanReceiver(const Expr* receiver) {
+        if (auto* var = dynamic_cast<const VariableExpr*>(receiver)) {
+            auto it = candidates.find(var->getName());
+            if (it != candidates.end() && it->second.def &&
+                !classKeepsThis(it->second.className)) {
+                escape(var->getName());
+            }
+            return;
+        }
+        if (dynamic_cast<const ThisExpr*>(receiver)) return;
+        scanExpr(receiver);
+    }
+};
+
+// Collect `var x = new C(...)` declarations anywhere in the body. A
+// name declared more than once is dropped - the scanner is keyed by
+// name and cannot tell shadowed bindings apart.
+void collectCandidates(const std::vector<std::unique_ptr<Stmt>>& stmts,
+                       std::map<std::string, EscapeScanner::Candidate>& out,
+                       std::set<std::string>& duplicates) {
+    for (const auto& stmt : stmts) {
+        if (auto* varDecl = dynamic_cast<const VarDeclStmt*>(stmt.get())) {
+            if (auto* newExpr = dynamic_cast<const NewExpr*>(varDecl->getInit())) {
+                if (!out.emplace(varDecl->getName(),
+                        EscapeScanner::Candidate{newExpr, newExpr->getClassName()})
+                         .second) {
+                    duplicates.insert(varDecl->getName());
+                }
+            }
+        } else if (auto* ifStmt = dynamic_cast<const IfStmt*>(stmt.get())) {
+            collectCandidates(ifStmt->getThenBranch(), out, duplicates);
+            collectCandidates(ifStmt->getElseBranch(), out, duplicates);
+        } else if (auto* match = dynamic_cast<const MatchStmt*>(stmt.get())) {
+            for (const auto& arm : match->getArms()) {
+                collectCandidates(arm.body, out, duplicates);
+            }
+            collectCandidates(match->getDefaultBody(), out, duplicates);
+        } else if (auto* whileStmt = dynamic_cast<const WhileStmt*>(stmt.get())) {
+            collectCandidates(whileStmt->getBody(), out, duplicates);
+        } else if (auto* forStmt = dynamic_cast<const ForStmt*>(stmt.get())) {
+            collectCandidates(forStmt->getBody(), out, duplicates);
+        } else if (auto* loop = dynamic_cast<const LoopStmt*>(stmt.get())) {
+            collectCandidates(loop->getBody(), out, duplicates);
+        }
+    }
+}
+
+} // namespace
+
+std::set<const NewExpr*> findStackAllocatableNews(
+    const std::vector<std::unique_ptr<Stmt>>& body) {
+    EscapeScanner scanner;
+    std::set<std::string> duplicates;
+    collectCandidates(body, scanner.candidates, duplicates);
+    for (const auto& name : duplicates) {
+        scanner.candidates.erase(name);
+    }
+    if (scanner.candidates.empty()) {
+        return {};
+    }
+
+    scanner.scanStmts(body);
+
+    std::set<const NewExpr*> result;
+    for (const auto& [name, candidate] : scanner.candidates) {
+        if (!scanner.escaped(name)) {
+            result.insert(candidate.def);
+        }
+    }
+    return result;
+}
+
+} // namespace aurora
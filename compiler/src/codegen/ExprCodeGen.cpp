@@ -35,7 +35,7 @@ llvm::Value* IntLiteralExpr::codegen() {
     return llvm::ConstantInt::get(ctx.getContext(), llvm::APInt(64, value, true));
 }
 
-std::shared_ptr<Type> IntLiteralExpr::getType() const {
+Type* IntLiteralExpr::getType() const {
     return TypeRegistry::instance().getIntType();
 }
 
@@ -46,7 +46,7 @@ llvm::Value* DoubleLiteralExpr::codegen() {
     return llvm::ConstantFP::get(ctx.getContext(), llvm::APFloat(value));
 }
 
-std::shared_ptr<Type> DoubleLiteralExpr::getType() const {
+Type* DoubleLiteralExpr::getType() const {
     return TypeRegistry::instance().getDoubleType();
 }
 
@@ -58,7 +58,7 @@ llvm::Value* BoolExpr::codegen() {
     return llvm::ConstantInt::get(llvm::Type::getInt1Ty(ctx.getContext()), value ? 1 : 0);
 }
 
-std::shared_ptr<Type> BoolExpr::getType() const {
+Type* BoolExpr::getType() const {
     return TypeRegistry::instance().getBoolType();
 }
 
@@ -70,7 +70,7 @@ NullExpr::NullExpr() {
     );
 }
 
-void NullExpr::setResolvedType(std::shared_ptr<Type> t) {
+void NullExpr::setResolvedType(Type* t) {
     if (t) {
         resolvedType = std::move(t);
     }
@@ -79,7 +79,7 @@ void NullExpr::setResolvedType(std::shared_ptr<Type> t) {
 llvm::Value* NullExpr::codegen() {
     auto& ctx = getGlobalContext();
     
-    if (auto optionalType = std::dynamic_pointer_cast<OptionalType>(resolvedType)) {
+    if (auto optionalType = dynamic_cast<OptionalType*>(resolvedType)) {
         llvm::Type* llvmOptionalType = optionalType->toLLVMType(ctx.getContext());
         return llvm::Constant::getNullValue(llvmOptionalType);
     }
@@ -88,7 +88,7 @@ llvm::Value* NullExpr::codegen() {
     return llvm::ConstantPointerNull::get(llvm::PointerType::get(ctx.getContext(), 0));
 }
 
-std::shared_ptr<Type> NullExpr::getType() const {
+Type* NullExpr::getType() const {
     return resolvedType;
 }
 
@@ -96,39 +96,20 @@ std::shared_ptr<Type> NullExpr::getType() const {
 
 llvm::Value* StringExpr::codegen() {
     auto& ctx = getGlobalContext();
-    
-    llvm::Constant* strConstant = llvm::ConstantDataArray::getString(
-        ctx.getContext(), value, true);
-    
-    auto* globalStr = new llvm::GlobalVariable(
-        ctx.getModule(),
-        strConstant->getType(),
-        true,
-        llvm::GlobalValue::PrivateLinkage,
-        strConstant,
-        ".str"
-    );
-    
-    std::vector<llvm::Value*> indices = {
-        llvm::ConstantInt::get(llvm::Type::getInt32Ty(ctx.getContext()), 0),
-        llvm::ConstantInt::get(llvm::Type::getInt32Ty(ctx.getContext()), 0)
-    };
-    
-    return ctx.getBuilder().CreateInBoundsGEP(
-        strConstant->getType(),
-        globalStr,
-        indices,
-        "str"
-    );
+
+    // Every use of a literal shares one immortal constant AuroraString;
+    // no allocation or copy happens at runtime, and a literal inside a
+    // loop costs nothing per iteration
+    return ctx.getOrCreateInternedString(value);
 }
 
-std::shared_ptr<Type> StringExpr::getType() const {
+Type* StringExpr::getType() const {
     return TypeRegistry::instance().getStringType();
 }
 
 // ===== Variable Expression =====
 
-std::shared_ptr<Type> VariableExpr::getType() const {
+Type* VariableExpr::getType() const {
     auto& ctx = getGlobalContext();
     auto varType = ctx.getVariableType(name);
     if (varType) {
@@ -141,7 +122,7 @@ llvm::Value* VariableExpr::codegen() {
     auto& ctx = getGlobalContext();
     
     auto& named_values = ctx.getNamedValues();
-    llvm::AllocaInst* alloca = named_values[name];
+    llvm::AllocaInst* alloca = named_values.lookup(name);
     
     if (!alloca) {
         // Check if it's a function parameter (legacy behavior)
@@ -213,8 +194,8 @@ llvm::Value* BinaryExpr::codegen() {
     bool left_is_ptr = L->getType()->isPointerTy();
     bool right_is_ptr = R->getType()->isPointerTy();
     
-    auto leftOptional = left ? std::dynamic_pointer_cast<OptionalType>(left->getType()) : nullptr;
-    auto rightOptional = right ? std::dynamic_pointer_cast<OptionalType>(right->getType()) : nullptr;
+    auto leftOptional = left ? dynamic_cast<OptionalType*>(left->getType()) : nullptr;
+    auto rightOptional = right ? dynamic_cast<OptionalType*>(right->getType()) : nullptr;
     
     auto isNullConstant = [](llvm::Value* value) {
         if (auto* constant = llvm::dyn_cast<llvm::Constant>(value)) {
@@ -373,7 +354,7 @@ llvm::Value* BinaryExpr::codegen() {
     }
 }
 
-std::shared_ptr<Type> BinaryExpr::getType() const {
+Type* BinaryExpr::getType() const {
     return TypeRegistry::instance().getDoubleType();
 }
 
@@ -406,15 +387,82 @@ llvm::Value* UnaryExpr::codegen() {
     }
 }
 
-std::shared_ptr<Type> UnaryExpr::getType() const {
+Type* UnaryExpr::getType() const {
     return expr->getType();
 }
 
 // ===== Call Expression =====
 
+// Flatten nested aurora_string_concat calls into a left-to-right operand
+// list. Returns false when expr is not a two-argument concat call.
+static bool collectConcatOperands(Expr* expr, std::vector<Expr*>& operands) {
+    auto* call = dynamic_cast<CallExpr*>(expr);
+    if (!call || call->getCallee() != "aurora_string_concat" ||
+        call->getArgs().size() != 2) {
+        return false;
+    }
+    for (auto& arg : call->getArgs()) {
+        if (!collectConcatOperands(arg.get(), operands)) {
+            operands.push_back(arg.get());
+        }
+    }
+    return true;
+}
+
+// Get or create a string builder runtime function declaration; the ones
+// used here take only pointer parameters, so a count suffices
+static llvm::Function* getStringBuilderFunc(CodeGenContext& ctx, const char* name,
+                                            bool returnsPointer, unsigned numPtrArgs) {
+    llvm::Function* func = ctx.getModule().getFunction(name);
+    if (func) {
+        return func;
+    }
+
+    llvm::Type* ptrType = llvm::PointerType::get(ctx.getContext(), 0);
+    std::vector<llvm::Type*> params(numPtrArgs, ptrType);
+    llvm::FunctionType* funcType = llvm::FunctionType::get(
+        returnsPointer ? ptrType : llvm::Type::getVoidTy(ctx.getContext()),
+        params,
+        false);
+    return llvm::Function::Create(funcType,
+        llvm::Function::ExternalLinkage, name, ctx.getModule());
+}
+
+// Lower a flattened concatenation chain through the runtime string
+// builder: one growing buffer and a single materialization instead of a
+// fresh allocation and copy per link
+static llvm::Value* codegenConcatChain(CodeGenContext& ctx,
+                                       const std::vector<Expr*>& operands) {
+    llvm::Function* createFunc =
+        getStringBuilderFunc(ctx, "aurora_string_builder_create", true, 0);
+    llvm::Function* appendFunc =
+        getStringBuilderFunc(ctx, "aurora_string_builder_append", false, 2);
+    llvm::Function* finishFunc =
+        getStringBuilderFunc(ctx, "aurora_string_builder_finish", true, 1);
+
+    llvm::Value* builder = ctx.getBuilder().CreateCall(createFunc, {}, "sb");
+    for (Expr* operand : operands) {
+        llvm::Value* piece = operand->codegen();
+        if (!piece) return nullptr;
+        ctx.getBuilder().CreateCall(appendFunc, {builder, piece});
+    }
+    return ctx.getBuilder().CreateCall(finishFunc, {builder}, "sb_str");
+}
+
 llvm::Value* CallExpr::codegen() {
     auto& ctx = getGlobalContext();
-    
+
+    // Chained concatenation (concat nested inside concat) builds the
+    // result incrementally rather than re-copying the growing prefix at
+    // every link
+    if (callee == "aurora_string_concat" && args.size() == 2) {
+        std::vector<Expr*> operands;
+        collectConcatOperands(this, operands);
+        if (operands.size() > 2) {
+            return codegenConcatChain(ctx, operands);
+        }
+    }
+
     llvm::Function* callee_func = ctx.getFunction(callee);
     if (!callee_func) {
         return logError(("Unknown function: " + callee).c_str());
@@ -467,7 +515,7 @@ llvm::Value* NullCheckExpr::codegen() {
     if (!value) return nullptr;
     
     auto exprType = expr->getType();
-    if (auto optionalType = std::dynamic_pointer_cast<OptionalType>(exprType)) {
+    if (auto optionalType = dynamic_cast<OptionalType*>(exprType)) {
         llvm::Value* hasValue = ctx.getBuilder().CreateExtractValue(value, 0, "has_value");
         return ctx.getBuilder().CreateICmpNE(
             hasValue,
@@ -485,7 +533,7 @@ llvm::Value* NullCheckExpr::codegen() {
     return logError("Null check requires optional or pointer type");
 }
 
-std::shared_ptr<Type> NullCheckExpr::getType() const {
+Type* NullCheckExpr::getType() const {
     return TypeRegistry::instance().getBoolType();
 }
 
@@ -537,7 +585,7 @@ llvm::Value* TernaryExpr::codegen() {
     return phi;
 }
 
-std::shared_ptr<Type> TernaryExpr::getType() const {
+Type* TernaryExpr::getType() const {
     return trueExpr->getType();
 }
 
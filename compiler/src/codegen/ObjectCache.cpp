@@ -0,0 +1,100 @@
+#include "aurora/ObjectCache.h"
+#include "aurora/Logger.h"
+#include <llvm/Config/llvm-config.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Support/MD5.h>
+#include <llvm/Support/raw_ostream.h>
+#include <cstdlib>
+#include <filesystem>
+#include <system_error>
+
+namespace aurora {
+
+// Bump when the cached object format or keying scheme changes
+static constexpr const char* kCacheFormatVersion = "1";
+
+AuroraObjectCache::AuroraObjectCache() {
+    auto& logger = Logger::instance();
+
+    const char* env_dir = std::getenv("AURORA_CACHE_DIR");
+    if (env_dir && env_dir[0] != '\0') {
+        cache_dir_ = env_dir;
+    } else {
+        const char* home = std::getenv("HOME");
+        if (home && home[0] != '\0') {
+            cache_dir_ = std::string(home) + "/.cache/aurora";
+        }
+    }
+
+    if (cache_dir_.empty()) {
+        logger.debug("No cache directory available, JIT cache disabled", "JITCache");
+        return;
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(cache_dir_, ec);
+    if (ec) {
+        Logger::instance().warning("Cannot create JIT cache directory " + cache_dir_ +
+                                   ": " + ec.message());
+        return;
+    }
+
+    enabled_ = true;
+    logger.debug("JIT object cache: " + cache_dir_, "JITCache");
+}
+
+std::string AuroraObjectCache::cacheFileFor(const llvm::Module* module) {
+    // Key on the full IR text so any change in source, imports, or
+    // optimization output produces a different entry; mixing in the LLVM
+    // version keeps objects from other toolchains out
+    std::string ir;
+    llvm::raw_string_ostream os(ir);
+    module->print(os, nullptr);
+    os.flush();
+
+    llvm::MD5 md5;
+    md5.update(ir);
+    md5.update(LLVM_VERSION_STRING);
+    md5.update(kCacheFormatVersion);
+    llvm::MD5::MD5Result result;
+    md5.final(result);
+
+    llvm::SmallString<32> hex;
+    llvm::MD5::stringifyResult(result, hex);
+    return cache_dir_ + "/aurora-" + std::string(hex.str()) + ".o";
+}
+
+void AuroraObjectCache::notifyObjectCompiled(const llvm::Module* module,
+                                             llvm::MemoryBufferRef obj) {
+    if (!enabled_) {
+        return;
+    }
+
+    std::string path = cacheFileFor(module);
+    std::error_code ec;
+    llvm::raw_fd_ostream out(path, ec);
+    if (ec) {
+        Logger::instance().warning("Cannot write JIT cache entry " + path + ": " + ec.message());
+        return;
+    }
+    out.write(obj.getBufferStart(), obj.getBufferSize());
+    Logger::instance().debug("Cached compiled object: " + path, "JITCache");
+}
+
+std::unique_ptr<llvm::MemoryBuffer> AuroraObjectCache::getObject(const llvm::Module* module) {
+    if (!enabled_) {
+        return nullptr;
+    }
+
+    std::string path = cacheFileFor(module);
+    auto buffer = llvm::MemoryBuffer::getFile(path);
+    if (!buffer) {
+        Logger::instance().debug("JIT cache miss for module: " + module->getModuleIdentifier(),
+                                 "JITCache");
+        return nullptr;
+    }
+    Logger::instance().debug("JIT cache hit: " + path, "JITCache");
+    return std::move(*buffer);
+}
+
+} // namespace aurora
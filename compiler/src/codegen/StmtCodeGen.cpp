@@ -1,10 +1,14 @@
 #include "aurora/AST.h"
 #include "aurora/CodeGen.h"
 #include "aurora/Diagnostic.h"
+#include "aurora/EscapeAnalysis.h"
 #include <llvm/IR/Constants.h>
 #include <llvm/IR/Function.h>
+#include <llvm/IR/Instructions.h>
 #include <llvm/IR/Type.h>
 #include <llvm/IR/Verifier.h>
+#include <map>
+#include <set>
 
 namespace aurora {
 
@@ -121,16 +125,25 @@ llvm::Value* VarDeclStmt::codegen() {
         function, name, allocaType);
     
     ctx.getBuilder().CreateStore(init_val, alloca);
-    ctx.getNamedValues()[name] = alloca;
+    ctx.getNamedValues().insert(name, alloca);
     ctx.setVariableType(name, type);
     
     // Track this variable for release at scope end
     // Only track arrays for now (objects don't have ARC header yet)
-    auto arrayType = std::dynamic_pointer_cast<ArrayType>(type);
+    auto arrayType = dynamic_cast<ArrayType*>(type);
     if (arrayType) {
         ctx.trackVariable(name, alloca);
+
+        // Immutable literal-initialized arrays have a length that can
+        // never change underneath an elided bounds check
+        if (!mutable_) {
+            if (auto* literal = dynamic_cast<ArrayLiteralExpr*>(init.get())) {
+                ctx.setStaticArrayLength(name,
+                    static_cast<int64_t>(literal->getElements().size()));
+            }
+        }
     }
-    
+
     return alloca;
 }
 
@@ -201,6 +214,187 @@ llvm::Value* IfStmt::codegen() {
     }
 }
 
+// ===== Match Statement =====
+
+// Compile-time FNV-1a hash of a string pattern. Must produce the same value
+// as aurora_string_hash in the runtime, which hashes the subject at dispatch
+// time.
+static uint64_t hashStringPattern(const std::string& s) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (unsigned char c : s) {
+        hash ^= c;
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+llvm::Value* MatchStmt::codegen() {
+    auto& ctx = getGlobalContext();
+
+    llvm::Value* subject_val = subject->codegen();
+    if (!subject_val) return nullptr;
+
+    if (arms.empty()) {
+        return logError("Match statement requires at least one arm");
+    }
+
+    // Classify the patterns: every arm must use the same literal kind
+    bool string_match = dynamic_cast<StringExpr*>(arms.front().patterns.front().get()) != nullptr;
+    for (const auto& arm : arms) {
+        for (const auto& pattern : arm.patterns) {
+            bool is_string = dynamic_cast<StringExpr*>(pattern.get()) != nullptr;
+            bool is_int = dynamic_cast<IntLiteralExpr*>(pattern.get()) != nullptr;
+            if (!is_string && !is_int) {
+                return logError("Match patterns must be integer or string literals");
+            }
+            if (is_string != string_match) {
+                return logError("Match statement mixes integer and string patterns");
+            }
+        }
+    }
+
+    llvm::Function* function = ctx.getBuilder().GetInsertBlock()->getParent();
+    llvm::BasicBlock* default_bb = llvm::BasicBlock::Create(ctx.getContext(), "matchelse");
+    llvm::BasicBlock* merge_bb = llvm::BasicBlock::Create(ctx.getContext(), "matchcont");
+
+    // One body block per arm; an arm with several patterns shares one block
+    std::vector<llvm::BasicBlock*> arm_blocks;
+    for (size_t i = 0; i < arms.size(); ++i) {
+        arm_blocks.push_back(llvm::BasicBlock::Create(ctx.getContext(), "matcharm"));
+    }
+
+    if (!string_match) {
+        // Integer subject: a single switch lets LLVM pick the dispatch shape
+        // (jump table, bit tests, or compare tree) instead of the O(arms)
+        // compare chain an if/else ladder would produce
+        if (!subject_val->getType()->isIntegerTy()) {
+            return logError("Match subject must be an integer for integer patterns");
+        }
+        llvm::SwitchInst* sw = ctx.getBuilder().CreateSwitch(
+            subject_val, default_bb, arms.size());
+        std::set<int64_t> seen;
+        for (size_t i = 0; i < arms.size(); ++i) {
+            for (const auto& pattern : arms[i].patterns) {
+                auto* lit = static_cast<IntLiteralExpr*>(pattern.get());
+                if (!seen.insert(lit->getValue()).second) {
+                    return logError("Duplicate integer pattern in match statement");
+                }
+                sw->addCase(llvm::ConstantInt::get(
+                    llvm::cast<llvm::IntegerType>(subject_val->getType()),
+                    lit->getValue()), arm_blocks[i]);
+            }
+        }
+    } else {
+        // String subject: switch on the runtime hash so dispatch stays O(1)
+        // in arm count, then confirm the winning bucket with a full equality
+        // check so hash collisions cannot select the wrong arm
+        if (!subject_val->getType()->isPointerTy()) {
+            return logError("Match subject must be a string for string patterns");
+        }
+        llvm::PointerType* ptr_type = llvm::PointerType::get(ctx.getContext(), 0);
+
+        llvm::Function* hash_func = ctx.getModule().getFunction("aurora_string_hash");
+        if (!hash_func) {
+            hash_func = llvm::Function::Create(
+                llvm::FunctionType::get(llvm::Type::getInt64Ty(ctx.getContext()),
+                                        {ptr_type}, false),
+                llvm::Function::ExternalLinkage, "aurora_string_hash",
+                ctx.getModule());
+        }
+        llvm::Function* equals_func = ctx.getModule().getFunction("aurora_string_equals");
+        if (!equals_func) {
+            equals_func = llvm::Function::Create(
+                llvm::FunctionType::get(llvm::Type::getInt32Ty(ctx.getContext()),
+                                        {ptr_type, ptr_type}, false),
+                llvm::Function::ExternalLinkage, "aurora_string_equals",
+                ctx.getModule());
+        }
+
+        // Group patterns by hash; colliding patterns share a bucket and are
+        // disambiguated by the equality chain inside it
+        std::map<uint64_t, std::vector<std::pair<StringExpr*, size_t>>> buckets;
+        std::set<std::string> seen;
+        for (size_t i = 0; i < arms.size(); ++i) {
+            for (const auto& pattern : arms[i].patterns) {
+                auto* lit = static_cast<StringExpr*>(pattern.get());
+                if (!seen.insert(lit->getValue()).second) {
+                    return logError("Duplicate string pattern in match statement");
+                }
+                buckets[hashStringPattern(lit->getValue())].push_back({lit, i});
+            }
+        }
+
+        llvm::Value* hash_val = ctx.getBuilder().CreateCall(
+            hash_func, {subject_val}, "matchhash");
+        llvm::SwitchInst* sw = ctx.getBuilder().CreateSwitch(
+            hash_val, default_bb, buckets.size());
+
+        for (auto& bucket : buckets) {
+            llvm::BasicBlock* bucket_bb = llvm::BasicBlock::Create(
+                ctx.getContext(), "matchbucket", function);
+            sw->addCase(llvm::ConstantInt::get(
+                llvm::Type::getInt64Ty(ctx.getContext()), bucket.first),
+                bucket_bb);
+            ctx.getBuilder().SetInsertPoint(bucket_bb);
+
+            auto& entries = bucket.second;
+            for (size_t j = 0; j < entries.size(); ++j) {
+                llvm::Value* pattern_val = entries[j].first->codegen();
+                if (!pattern_val) return nullptr;
+                llvm::Value* eq = ctx.getBuilder().CreateCall(
+                    equals_func, {subject_val, pattern_val}, "matcheq");
+                llvm::Value* cond = ctx.getBuilder().CreateICmpNE(eq,
+                    llvm::ConstantInt::get(eq->getType(), 0), "matchcase");
+                if (j + 1 < entries.size()) {
+                    llvm::BasicBlock* next_bb = llvm::BasicBlock::Create(
+                        ctx.getContext(), "matchnext", function);
+                    ctx.getBuilder().CreateCondBr(cond, arm_blocks[entries[j].second], next_bb);
+                    ctx.getBuilder().SetInsertPoint(next_bb);
+                } else {
+                    ctx.getBuilder().CreateCondBr(cond, arm_blocks[entries[j].second], default_bb);
+                }
+            }
+        }
+    }
+
+    // Emit arm bodies
+    bool merge_needed = false;
+    for (size_t i = 0; i < arms.size(); ++i) {
+        function->insert(function->end(), arm_blocks[i]);
+        ctx.getBuilder().SetInsertPoint(arm_blocks[i]);
+        for (auto& stmt : arms[i].body) {
+            stmt->codegen();
+        }
+        if (!ctx.getBuilder().GetInsertBlock()->getTerminator()) {
+            ctx.getBuilder().CreateBr(merge_bb);
+            merge_needed = true;
+        }
+    }
+
+    // Emit the default ('else') body; an empty body just falls through
+    function->insert(function->end(), default_bb);
+    ctx.getBuilder().SetInsertPoint(default_bb);
+    for (auto& stmt : defaultBody) {
+        stmt->codegen();
+    }
+    if (!ctx.getBuilder().GetInsertBlock()->getTerminator()) {
+        ctx.getBuilder().CreateBr(merge_bb);
+        merge_needed = true;
+    }
+
+    if (merge_needed) {
+        function->insert(function->end(), merge_bb);
+        ctx.getBuilder().SetInsertPoint(merge_bb);
+        return merge_bb;
+    } else {
+        delete merge_bb;
+        llvm::BasicBlock* unreachable_bb = llvm::BasicBlock::Create(
+            ctx.getContext(), "unreachable", function);
+        ctx.getBuilder().SetInsertPoint(unreachable_bb);
+        return unreachable_bb;
+    }
+}
+
 // ===== While Statement =====
 
 llvm::Value* WhileStmt::codegen() {
@@ -257,6 +451,37 @@ llvm::Value* WhileStmt::codegen() {
 
 // ===== For Statement =====
 
+// Whether any statement in the subtree writes (or rebinds) `var`. Used
+// to validate induction variables before bounds checks are elided: a
+// body that never stores to the variable keeps it within the range the
+// loop header established.
+static bool bodyReassignsVariable(const std::vector<std::unique_ptr<Stmt>>& stmts,
+                                  const std::string& var) {
+    for (const auto& stmt : stmts) {
+        if (auto* assign = dynamic_cast<AssignStmt*>(stmt.get())) {
+            if (auto* target = dynamic_cast<VariableExpr*>(assign->getTarget())) {
+                if (target->getName() == var) return true;
+            }
+        } else if (auto* decl = dynamic_cast<VarDeclStmt*>(stmt.get())) {
+            // A shadowing declaration re-binds the name, so later uses
+            // no longer refer to the induction variable
+            if (decl->getName() == var) return true;
+        } else if (auto* ifStmt = dynamic_cast<IfStmt*>(stmt.get())) {
+            if (bodyReassignsVariable(ifStmt->getThenBranch(), var) ||
+                bodyReassignsVariable(ifStmt->getElseBranch(), var)) return true;
+        } else if (auto* whileStmt = dynamic_cast<WhileStmt*>(stmt.get())) {
+            if (bodyReassignsVariable(whileStmt->getBody(), var)) return true;
+        } else if (auto* forStmt = dynamic_cast<ForStmt*>(stmt.get())) {
+            // A nested loop over the same name rebinds it for its extent
+            if (forStmt->getVarName() == var) return true;
+            if (bodyReassignsVariable(forStmt->getBody(), var)) return true;
+        } else if (auto* loopStmt = dynamic_cast<LoopStmt*>(stmt.get())) {
+            if (bodyReassignsVariable(loopStmt->getBody(), var)) return true;
+        }
+    }
+    return false;
+}
+
 llvm::Value* ForStmt::codegen() {
     auto& ctx = getGlobalContext();
     
@@ -280,8 +505,8 @@ llvm::Value* ForStmt::codegen() {
     
     ctx.getBuilder().CreateStore(start_val, var_alloca);
     
-    auto old_var = ctx.getNamedValues()[varName];
-    ctx.getNamedValues()[varName] = var_alloca;
+    auto old_var = ctx.getNamedValues().lookup(varName);
+    ctx.getNamedValues().insert(varName, var_alloca);
     
     llvm::BasicBlock* cond_bb = llvm::BasicBlock::Create(ctx.getContext(), "forcond", function);
     llvm::BasicBlock* body_bb = llvm::BasicBlock::Create(ctx.getContext(), "forbody");
@@ -289,8 +514,23 @@ llvm::Value* ForStmt::codegen() {
     llvm::BasicBlock* after_bb = llvm::BasicBlock::Create(ctx.getContext(), "afterfor");
     
     ctx.pushLoopContext(after_bb, step_bb);
+
+    // Record range facts for bounds-check elision when this is a simple
+    // counted loop: constant non-negative bounds, the default +1 step,
+    // and a body that never writes the induction variable
+    auto* startLit = dynamic_cast<IntLiteralExpr*>(startExpr.get());
+    auto* endLit = dynamic_cast<IntLiteralExpr*>(endExpr.get());
+    ctx.getCurrentLoop()->inductionVar = varName;
+    if (startLit && endLit && !stepExpr &&
+        startLit->getValue() >= 0 &&
+        !bodyReassignsVariable(body, varName)) {
+        ctx.getCurrentLoop()->counted = true;
+        ctx.getCurrentLoop()->constLower = startLit->getValue();
+        ctx.getCurrentLoop()->constUpper = endLit->getValue();
+    }
+
     ctx.getBuilder().CreateBr(cond_bb);
-    
+
     // Emit condition block
     ctx.getBuilder().SetInsertPoint(cond_bb);
     llvm::Value* cur_val = ctx.getBuilder().CreateLoad(
@@ -353,7 +593,7 @@ llvm::Value* ForStmt::codegen() {
     ctx.getBuilder().SetInsertPoint(after_bb);
     
     if (old_var) {
-        ctx.getNamedValues()[varName] = old_var;
+        ctx.getNamedValues().insert(varName, old_var);
     } else {
         ctx.getNamedValues().erase(varName);
     }
@@ -439,7 +679,7 @@ llvm::Value* AssignStmt::codegen() {
     if (auto* varExpr = dynamic_cast<VariableExpr*>(target.get())) {
         std::string name = varExpr->getName();
         auto& named_values = ctx.getNamedValues();
-        llvm::AllocaInst* alloca = named_values[name];
+        llvm::AllocaInst* alloca = named_values.lookup(name);
         
         if (!alloca) {
             return logError(("Unknown variable: " + name).c_str());
@@ -450,8 +690,14 @@ llvm::Value* AssignStmt::codegen() {
             // Release the old value first
             ctx.insertRelease(alloca);
             
-            // Retain the new value (increases ref count)
-            val = ctx.insertRetain(val);
+            // Fresh allocations arrive with ref_count=1; storing them is
+            // an ownership transfer, so retaining again would just leak
+            bool freshValue = dynamic_cast<NewExpr*>(value.get()) != nullptr ||
+                              dynamic_cast<ArrayLiteralExpr*>(value.get()) != nullptr;
+            if (!freshValue) {
+                // Retain the new value (increases ref count)
+                val = ctx.insertRetain(val);
+            }
         }
         
         ctx.getBuilder().CreateStore(val, alloca);
@@ -479,11 +725,17 @@ llvm::Value* AssignStmt::codegen() {
             }
         }
         
+        // Bounds check, unless the index is provably inside a
+        // statically-sized array
+        if (!ctx.arrayIndexProvablySafe(arrayIndex->getArray(), arrayIndex->getIndex())) {
+            ctx.insertArrayBoundsCheck(arrayVal, indexVal);
+        }
+
         // Extract data pointer from array struct
         llvm::Value* dataPtr = ctx.getBuilder().CreateExtractValue(arrayVal, 1, "array_data");
-        
+
         // Get element type
-        auto arrayType = std::dynamic_pointer_cast<ArrayType>(arrayIndex->getArray()->getType());
+        auto arrayType = dynamic_cast<ArrayType*>(arrayIndex->getArray()->getType());
         if (!arrayType) {
             return logError("Array index on non-array type in assignment");
         }
@@ -557,12 +809,14 @@ llvm::Function* Function::codegen() {
     ctx.pushScope();
     
     ctx.getNamedValues().clear();
+    ctx.clearStaticArrayLengths();
+    ctx.setStackAllocatableNews(findStackAllocatableNews(body));
     size_t param_idx = 0;
     for (auto& arg : func->args()) {
         llvm::AllocaInst* alloca = ctx.createEntryBlockAlloca(
             func, std::string(arg.getName()), arg.getType());
         ctx.getBuilder().CreateStore(&arg, alloca);
-        ctx.getNamedValues()[std::string(arg.getName())] = alloca;
+        ctx.getNamedValues().insert(std::string(arg.getName()), alloca);
         
         // Store parameter type information for type checking
         if (param_idx < proto->getParams().size()) {
@@ -1,18 +1,103 @@
 #include "aurora/LanguageCore.h"
 #include "aurora/Parser.h"
+#include "aurora/SymbolIndex.h"
 #include "aurora/Logger.h"
 
 namespace aurora {
 
-LanguageCore::LanguageCore() {
+// ===== Source Segmentation =====
+
+namespace {
+
+struct SegmentSlice {
+    std::string text;
+    size_t start_line;
+};
+
+bool isTopLevelStarter(TokenType type) {
+    switch (type) {
+        case TokenType::Package:
+        case TokenType::Import:
+        case TokenType::Extern:
+        case TokenType::Fn:
+        case TokenType::Class:
+        case TokenType::Object:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/// Split source into top-level declaration slices. A slice starts on the
+/// line of each 'package'/'import'/'extern'/'fn'/'class'/'object' keyword
+/// found outside braces; comments and blank lines between declarations stay
+/// attached to the preceding slice, which the parser skips harmlessly.
+/// Walks the file's cached token array rather than re-lexing the buffer.
+std::vector<SegmentSlice> segmentSource(const std::string& source,
+                                        const TokenStream& tokens) {
+    // Byte offset where each 1-based line begins
+    std::vector<size_t> line_starts;
+    line_starts.push_back(0);
+    for (size_t i = 0; i < source.size(); i++) {
+        if (source[i] == '\n') {
+            line_starts.push_back(i + 1);
+        }
+    }
+
+    std::vector<size_t> boundary_lines;
+    long depth = 0;
+    for (size_t i = 0; i < tokens.size(); i++) {
+        const Token& token = tokens.at(i);
+        if (token.type == TokenType::Eof) {
+            break;
+        }
+        if (token.type == TokenType::LeftBrace) {
+            depth++;
+        } else if (token.type == TokenType::RightBrace) {
+            if (depth > 0) depth--;
+        } else if (depth == 0 && isTopLevelStarter(token.type)) {
+            if (boundary_lines.empty() || boundary_lines.back() != token.line) {
+                boundary_lines.push_back(token.line);
+            }
+        }
+    }
+
+    std::vector<SegmentSlice> slices;
+    if (boundary_lines.empty()) {
+        slices.push_back({source, 1});
+        return slices;
+    }
+
+    // Leading comments before the first declaration join the first slice
+    boundary_lines.front() = 1;
+    for (size_t i = 0; i < boundary_lines.size(); i++) {
+        size_t start_line = boundary_lines[i];
+        size_t start_offset = line_starts[start_line - 1];
+        size_t end_offset = (i + 1 < boundary_lines.size())
+            ? line_starts[boundary_lines[i + 1] - 1]
+            : source.size();
+        slices.push_back({source.substr(start_offset, end_offset - start_offset),
+                          start_line});
+    }
+    return slices;
+}
+
+} // namespace
+
+LanguageCore::LanguageCore()
+    : symbol_index_(std::make_unique<SymbolIndex>()) {
     Logger::instance().debug("LanguageCore initialized");
 }
 
 LanguageCore::~LanguageCore() = default;
 
-void LanguageCore::setSource(const std::string& filename, const std::string& source) {
+void LanguageCore::setSource(const std::string& filename, std::string source) {
     auto& data = files_[filename];
-    data.source = source;
+    // Lex the new revision once; every later consumer (segment scanning,
+    // whole-file parses, position queries) reads this array
+    data.tokens.reset();
+    data.source = std::move(source);
+    data.tokens = std::make_unique<TokenStream>(std::string_view(data.source));
     data.diagnostics.clear();
     data.symbols.clear();
     Logger::instance().debug("Source set for file: " + filename);
@@ -20,6 +105,7 @@ void LanguageCore::setSource(const std::string& filename, const std::string& sou
 
 void LanguageCore::clearSource(const std::string& filename) {
     files_.erase(filename);
+    symbol_index_->removeFile(filename);
     Logger::instance().debug("Source cleared for file: " + filename);
 }
 
@@ -33,44 +119,149 @@ bool LanguageCore::analyze(const std::string& filename) {
     auto& data = it->second;
     data.diagnostics.clear();
     data.symbols.clear();
-    
-    try {
-        // Lexical analysis
-        data.lexer = std::make_unique<Lexer>(data.source);
-        
-        // Parse
-        Parser parser(*data.lexer);
-        getDiagnosticEngine().setFilename(filename);
-        getDiagnosticEngine().setSourceCode(data.source);
+
+    // Record-only: analysis runs on every keystroke, so the engine must
+    // not render to stderr; the records are serialized as LSP diagnostics
+    getDiagnosticEngine().setDeferredRendering(true);
+    getDiagnosticEngine().setFilename(filename);
+    getDiagnosticEngine().setSourceCode(data.source);
+    getDiagnosticEngine().clear();
+
+    // Split the new revision into top-level declaration slices and reuse
+    // every cached segment whose text is unchanged - only the edited
+    // declarations are re-lexed and re-parsed. Reused segments just get
+    // their line offset refreshed, so moving a declaration down the file
+    // costs nothing
+    if (!data.tokens) {
+        data.tokens = std::make_unique<TokenStream>(std::string_view(data.source));
+    }
+    auto slices = segmentSource(data.source, *data.tokens);
+    std::vector<std::unique_ptr<Segment>> previous = std::move(data.segments);
+    data.segments.clear();
+
+    size_t reused = 0;
+    bool all_ok = true;
+    for (auto& slice : slices) {
+        std::unique_ptr<Segment> segment;
+        for (auto& old : previous) {
+            if (old && old->ok && old->text == slice.text) {
+                segment = std::move(old);
+                segment->start_line = slice.start_line;
+                reused++;
+                break;
+            }
+        }
+        if (!segment) {
+            size_t diag_base = getDiagnosticEngine().getDiagnosticCount();
+            segment = parseSegment(std::move(slice.text), slice.start_line);
+            if (!segment->ok) {
+                captureSegmentDiagnostics(*segment, filename, diag_base);
+            }
+        }
+        if (!segment->ok) all_ok = false;
+        data.segments.push_back(std::move(segment));
+    }
+
+    // A declaration boundary the scanner got wrong (e.g. a stray brace)
+    // can make a slice unparseable even though the whole file is fine;
+    // fall back to a single whole-file parse before reporting errors
+    if (!all_ok && data.segments.size() > 1) {
         getDiagnosticEngine().clear();
-        
-        data.functions = parser.parseProgram();
-        data.classes = std::move(parser.getClasses());
-        data.imports = std::move(parser.getImports());
-        data.package = std::move(parser.getPackage());
-        
-        // Collect diagnostics
-        if (getDiagnosticEngine().hasErrors()) {
-            // Convert internal diagnostics to our format
-            // For now, we'll create a generic error
-            Diagnostic diag(DiagnosticLevel::Error, "PARSE_ERROR", 
-                          "Failed to parse file", SourceLocation(filename, 0, 0, 0));
-            data.diagnostics.push_back(diag);
+        data.segments.clear();
+        auto whole = parseSegment(data.source, 1, data.tokens.get());
+        all_ok = whole->ok;
+        if (!whole->ok) {
+            captureSegmentDiagnostics(*whole, filename, 0);
         }
-        
-        // Index symbols
-        indexSymbols(filename, data);
-        
-        Logger::instance().debug("Analysis completed for: " + filename);
-        return !getDiagnosticEngine().hasErrors();
-        
-    } catch (const std::exception& e) {
-        Logger::instance().error("Analysis failed for " + filename + ": " + e.what());
-        Diagnostic diag(DiagnosticLevel::Error, "INTERNAL_ERROR",
-                       std::string("Internal error: ") + e.what(),
-                       SourceLocation(filename, 0, 0, 0));
-        data.diagnostics.push_back(diag);
-        return false;
+        data.segments.push_back(std::move(whole));
+    }
+
+    for (const auto& segment : data.segments) {
+        if (!segment->ok) {
+            // Prefer the parser's own records; the generic entry only
+            // covers failures that produced no diagnostic (e.g. a lexer
+            // exception)
+            if (!segment->diagnostics.empty()) {
+                data.diagnostics.insert(data.diagnostics.end(),
+                                        segment->diagnostics.begin(),
+                                        segment->diagnostics.end());
+            } else {
+                data.diagnostics.push_back(Diagnostic(
+                    DiagnosticLevel::Error, "PARSE_ERROR",
+                    "Failed to parse declaration",
+                    SourceLocation(filename, segment->start_line, 1, 0)));
+            }
+        }
+    }
+
+    // Index symbols
+    indexSymbols(filename, data);
+    symbol_index_->updateFile(filename, SymbolIndex::hashContent(data.source),
+                              data.symbols);
+
+    Logger::instance().debug("Analysis completed for: " + filename + " (" +
+                             std::to_string(reused) + "/" +
+                             std::to_string(data.segments.size()) +
+                             " segments reused)");
+    return all_ok;
+}
+
+std::unique_ptr<LanguageCore::Segment> LanguageCore::parseSegment(std::string text,
+                                                                  size_t start_line,
+                                                                  const TokenStream* tokens) {
+    auto segment = std::make_unique<Segment>();
+    segment->text = std::move(text);
+    segment->start_line = start_line;
+    segment->arena = std::make_unique<ASTArena>();
+
+    try {
+        ASTArenaScope arena_scope(*segment->arena);
+        auto run = [&](Parser& parser) {
+            segment->functions = parser.parseProgram();
+            segment->classes = std::move(parser.getClasses());
+            segment->imports = std::move(parser.getImports());
+            segment->package = std::move(parser.getPackage());
+        };
+        if (tokens) {
+            // Whole-file parses reuse the per-file token cache
+            Parser parser(*tokens);
+            run(parser);
+        } else {
+            Lexer lexer{std::string_view(segment->text)};
+            Parser parser(lexer);
+            run(parser);
+        }
+    } catch (const std::exception&) {
+        segment->ok = false;
+    }
+    return segment;
+}
+
+// Move the engine records produced while parsing one segment onto the
+// segment, rewriting their locations from segment-relative lines to
+// whole-file lines under the real filename
+void LanguageCore::captureSegmentDiagnostics(Segment& segment,
+                                             const std::string& filename,
+                                             size_t diag_base) {
+    size_t line_offset = segment.start_line - 1;
+    for (const auto& recorded : getDiagnosticEngine().getDiagnosticsSince(diag_base)) {
+        const auto& loc = recorded.getLocation();
+        Diagnostic shifted(recorded.getLevel(), recorded.getCode(),
+                           recorded.getMessage(),
+                           SourceLocation(filename, loc.line + line_offset,
+                                          loc.column, loc.length));
+        for (const auto& note : recorded.getNotes()) {
+            SourceLocation note_loc = note.second;
+            if (note_loc.isValid()) {
+                note_loc.filename = filename;
+                note_loc.line += line_offset;
+            }
+            shifted.addNote(note.first, note_loc);
+        }
+        for (const auto& suggestion : recorded.getSuggestions()) {
+            shifted.addSuggestion(suggestion);
+        }
+        segment.diagnostics.push_back(std::move(shifted));
     }
 }
 
@@ -91,17 +282,18 @@ std::vector<SymbolInfo> LanguageCore::getSymbols(const std::string& filename) co
 }
 
 std::vector<SymbolInfo> LanguageCore::getWorkspaceSymbols(const std::string& query) const {
-    std::vector<SymbolInfo> results;
-    
-    for (const auto& [filename, data] : files_) {
-        for (const auto& symbol : data.symbols) {
-            if (query.empty() || symbol.name.find(query) != std::string::npos) {
-                results.push_back(symbol);
-            }
-        }
-    }
-    
-    return results;
+    // The index covers open files (analyze() updates it) plus everything
+    // restored from the previous session, and answers prefix queries by
+    // binary search instead of walking every file's symbol list
+    return symbol_index_->query(query);
+}
+
+size_t LanguageCore::loadWorkspaceIndex(const std::string& workspace_root) {
+    return symbol_index_->load(workspace_root);
+}
+
+bool LanguageCore::saveWorkspaceIndex() {
+    return symbol_index_->save();
 }
 
 HoverInfo LanguageCore::getHover(const std::string& filename, 
@@ -243,36 +435,41 @@ std::string LanguageCore::formatRange(const std::string& filename,
 
 void LanguageCore::indexSymbols(const std::string& filename, FileData& data) {
     data.symbols.clear();
-    
-    // Index package
-    if (data.package) {
-        SymbolInfo info;
-        info.name = data.package->getPackageName();
-        info.kind = SymbolInfo::Kind::Package;
-        info.location = SourceLocation(filename, 1, 1);
-        data.symbols.push_back(info);
-    }
-    
-    // Index imports
-    for (const auto& import : data.imports) {
-        SymbolInfo info;
-        info.name = import->getModulePath();
-        info.kind = SymbolInfo::Kind::Import;
-        info.location = SourceLocation(filename, 1, 1);
-        data.symbols.push_back(info);
-    }
-    
-    // Index functions
-    for (const auto& func : data.functions) {
-        collectFunctionSymbols(filename, func.get(), "", data.symbols);
-    }
-    
-    // Index classes
-    for (const auto& cls : data.classes) {
-        collectClassSymbols(filename, cls.get(), data.symbols);
+
+    for (const auto& segment : data.segments) {
+        // Node locations are relative to the segment's own text
+        size_t line_offset = segment->start_line - 1;
+
+        // Index package
+        if (segment->package) {
+            SymbolInfo info;
+            info.name = segment->package->getPackageName();
+            info.kind = SymbolInfo::Kind::Package;
+            info.location = SourceLocation(filename, segment->start_line, 1);
+            data.symbols.push_back(info);
+        }
+
+        // Index imports
+        for (const auto& import : segment->imports) {
+            SymbolInfo info;
+            info.name = import->getModulePath();
+            info.kind = SymbolInfo::Kind::Import;
+            info.location = SourceLocation(filename, segment->start_line, 1);
+            data.symbols.push_back(info);
+        }
+
+        // Index functions
+        for (const auto& func : segment->functions) {
+            collectFunctionSymbols(filename, func.get(), "", line_offset, data.symbols);
+        }
+
+        // Index classes
+        for (const auto& cls : segment->classes) {
+            collectClassSymbols(filename, cls.get(), line_offset, data.symbols);
+        }
     }
-    
-    Logger::instance().debug("Indexed " + std::to_string(data.symbols.size()) + 
+
+    Logger::instance().debug("Indexed " + std::to_string(data.symbols.size()) +
                   " symbols for: " + filename);
 }
 
@@ -285,19 +482,34 @@ SymbolInfo* LanguageCore::findSymbolAt(const std::string& filename,
     
     const auto& data = it->second;
     for (auto& symbol : const_cast<std::vector<SymbolInfo>&>(data.symbols)) {
-        if (symbol.location.line == line && 
+        if (symbol.location.line == line &&
             symbol.location.column <= column &&
             column < symbol.location.column + symbol.name.length()) {
             return &symbol;
         }
     }
-    
+
+    // The symbol list only records definition sites; for a cursor on a
+    // use, binary-search the cached token array for the identifier under
+    // the cursor and match it by name
+    if (data.tokens) {
+        const Token* token = data.tokens->tokenAt(line, column);
+        if (token && token->type == TokenType::Identifier) {
+            for (auto& symbol : const_cast<std::vector<SymbolInfo>&>(data.symbols)) {
+                if (std::string_view(symbol.name) == token->value) {
+                    return &symbol;
+                }
+            }
+        }
+    }
+
     return nullptr;
 }
 
 void LanguageCore::collectFunctionSymbols(const std::string& filename,
                                           const Function* func,
                                           const std::string& container,
+                                          size_t line_offset,
                                           std::vector<SymbolInfo>& symbols) {
     if (!func) return;
     
@@ -326,8 +538,9 @@ void LanguageCore::collectFunctionSymbols(const std::string& filename,
     }
     info.type = sig;
     
-    // Use actual location from AST node
-    info.location = SourceLocation(filename, proto->getLine(), proto->getColumn(), proto->getName().length());
+    // Use actual location from AST node, shifted to file coordinates
+    info.location = SourceLocation(filename, proto->getLine() + line_offset,
+                                   proto->getColumn(), proto->getName().length());
     symbols.push_back(info);
     
     // Index parameters as symbols
@@ -340,20 +553,23 @@ void LanguageCore::collectFunctionSymbols(const std::string& filename,
             paramInfo.type = param.type->toString();
         }
         // Parameters use same line as function, approximate column
-        paramInfo.location = SourceLocation(filename, proto->getLine(), proto->getColumn(), param.name.length());
+        paramInfo.location = SourceLocation(filename, proto->getLine() + line_offset,
+                                            proto->getColumn(), param.name.length());
         symbols.push_back(paramInfo);
     }
 }
 
 void LanguageCore::collectClassSymbols(const std::string& filename,
                                        const ClassDecl* cls,
+                                       size_t line_offset,
                                        std::vector<SymbolInfo>& symbols) {
     if (!cls) return;
-    
+
     SymbolInfo info;
     info.name = cls->getName();
     info.kind = SymbolInfo::Kind::Class;
-    info.location = SourceLocation(filename, cls->getLine(), cls->getColumn(), cls->getName().length());
+    info.location = SourceLocation(filename, cls->getLine() + line_offset,
+                                   cls->getColumn(), cls->getName().length());
     symbols.push_back(info);
     
     // Index fields
@@ -367,7 +583,8 @@ void LanguageCore::collectClassSymbols(const std::string& filename,
             fieldInfo.type = field.type->toString();
         }
         // Fields use same line as class (approximate), could be improved with field-level location tracking
-        fieldInfo.location = SourceLocation(filename, cls->getLine(), cls->getColumn(), field.name.length());
+        fieldInfo.location = SourceLocation(filename, cls->getLine() + line_offset,
+                                            cls->getColumn(), field.name.length());
         symbols.push_back(fieldInfo);
     }
     
@@ -396,7 +613,8 @@ void LanguageCore::collectClassSymbols(const std::string& filename,
         methodInfo.type = sig;
         
         // Methods use same line as class (approximate), could be improved with method-level location tracking
-        methodInfo.location = SourceLocation(filename, cls->getLine(), cls->getColumn(), method.name.length());
+        methodInfo.location = SourceLocation(filename, cls->getLine() + line_offset,
+                                             cls->getColumn(), method.name.length());
         symbols.push_back(methodInfo);
     }
 }
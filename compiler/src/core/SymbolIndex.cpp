@@ -0,0 +1,306 @@
+#include "aurora/SymbolIndex.h"
+#include "aurora/Logger.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <system_error>
+
+namespace aurora {
+
+// Bump when the on-disk index format changes; older files are ignored
+static constexpr const char* kIndexFormatVersion = "1";
+
+// ============================================================================
+// Hashing
+// ============================================================================
+
+// FNV-1a over arbitrary bytes; also used for the per-workspace file name
+static uint64_t fnv1a(const std::string& data) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (unsigned char c : data) {
+        hash ^= c;
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+static std::string toHex(uint64_t value) {
+    char buf[17];
+    std::snprintf(buf, sizeof(buf), "%016llx",
+                  static_cast<unsigned long long>(value));
+    return buf;
+}
+
+std::string SymbolIndex::hashContent(const std::string& source) {
+    return toHex(fnv1a(source));
+}
+
+static std::string toLower(const std::string& s) {
+    std::string out = s;
+    std::transform(out.begin(), out.end(), out.begin(),
+                   [](unsigned char c) { return std::tolower(c); });
+    return out;
+}
+
+// ============================================================================
+// Persistence
+// ============================================================================
+// Text format, one record per line:
+//   AURORA-SYMBOL-INDEX <version>
+//   F <content-hash> <filename>
+//   S <kind> <line> <column> <public> <static>\t<name>\t<type>\t<container>
+// Symbol fields after the fixed-width prefix are tab-separated because
+// type signatures contain spaces. S records attach to the preceding F.
+
+std::string SymbolIndex::indexPathFor(const std::string& workspace_root) const {
+    std::string cache_dir;
+    const char* env_dir = std::getenv("AURORA_CACHE_DIR");
+    if (env_dir && env_dir[0] != '\0') {
+        cache_dir = env_dir;
+    } else {
+        const char* home = std::getenv("HOME");
+        if (home && home[0] != '\0') {
+            cache_dir = std::string(home) + "/.cache/aurora";
+        }
+    }
+    if (cache_dir.empty()) {
+        return "";
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(cache_dir, ec);
+    if (ec) {
+        Logger::instance().warning("Cannot create cache directory " + cache_dir +
+                                   ": " + ec.message());
+        return "";
+    }
+    return cache_dir + "/aurora-symbols-" + toHex(fnv1a(workspace_root)) + ".idx";
+}
+
+size_t SymbolIndex::load(const std::string& workspace_root) {
+    auto& logger = Logger::instance();
+
+    index_path_ = indexPathFor(workspace_root);
+    if (index_path_.empty()) {
+        logger.debug("No cache directory available, symbol index is in-memory only",
+                     "SymbolIndex");
+        return 0;
+    }
+
+    std::ifstream in(index_path_);
+    if (!in) {
+        logger.debug("No saved symbol index at " + index_path_, "SymbolIndex");
+        return 0;
+    }
+
+    std::string header;
+    std::getline(in, header);
+    if (header != std::string("AURORA-SYMBOL-INDEX ") + kIndexFormatVersion) {
+        logger.debug("Ignoring symbol index with unknown format: " + index_path_,
+                     "SymbolIndex");
+        return 0;
+    }
+
+    files_.clear();
+    FileEntry* current = nullptr;
+    std::string current_file;
+    std::string line;
+    size_t restored = 0;
+    while (std::getline(in, line)) {
+        if (line.empty()) continue;
+        if (line[0] == 'F') {
+            // F <hash> <filename>; the filename runs to end of line
+            size_t hash_start = line.find(' ');
+            size_t name_start = line.find(' ', hash_start + 1);
+            if (hash_start == std::string::npos || name_start == std::string::npos) {
+                continue;
+            }
+            current_file = line.substr(name_start + 1);
+            current = &files_[current_file];
+            current->hash = line.substr(hash_start + 1, name_start - hash_start - 1);
+        } else if (line[0] == 'S' && current) {
+            std::istringstream fields(line);
+            char tag;
+            int kind = 0, is_public = 1, is_static = 0;
+            size_t sym_line = 0, sym_column = 0;
+            fields >> tag >> kind >> sym_line >> sym_column >> is_public >> is_static;
+            std::string rest;
+            std::getline(fields, rest);
+
+            // rest is "\t<name>\t<type>\t<container>"
+            std::vector<std::string> parts;
+            size_t pos = 0;
+            while (pos != std::string::npos && parts.size() < 3) {
+                size_t tab = rest.find('\t', pos + 1);
+                parts.push_back(rest.substr(pos + 1,
+                    tab == std::string::npos ? std::string::npos : tab - pos - 1));
+                pos = tab;
+            }
+            if (parts.size() < 3) continue;
+
+            SymbolInfo symbol;
+            symbol.name = parts[0];
+            symbol.type = parts[1];
+            symbol.containerName = parts[2];
+            symbol.location = SourceLocation(current_file, sym_line, sym_column);
+            symbol.kind = static_cast<SymbolInfo::Kind>(kind);
+            symbol.isPublic = (is_public != 0);
+            symbol.isStatic = (is_static != 0);
+            current->symbols.push_back(std::move(symbol));
+            restored++;
+        }
+    }
+
+    sorted_dirty_ = true;
+    logger.debug("Loaded symbol index: " + index_path_ + " (" +
+                 std::to_string(restored) + " symbols, " +
+                 std::to_string(files_.size()) + " files)", "SymbolIndex");
+    return restored;
+}
+
+bool SymbolIndex::save() {
+    if (index_path_.empty()) {
+        return false;
+    }
+
+    // Write to a temp file first so a crash mid-save cannot leave a
+    // truncated index behind
+    std::string tmp_path = index_path_ + ".tmp";
+    {
+        std::ofstream out(tmp_path, std::ios::trunc);
+        if (!out) {
+            Logger::instance().warning("Cannot write symbol index " + tmp_path);
+            return false;
+        }
+        out << "AURORA-SYMBOL-INDEX " << kIndexFormatVersion << "\n";
+        for (const auto& [filename, entry] : files_) {
+            out << "F " << entry.hash << " " << filename << "\n";
+            for (const auto& symbol : entry.symbols) {
+                out << "S " << static_cast<int>(symbol.kind)
+                    << " " << symbol.location.line
+                    << " " << symbol.location.column
+                    << " " << (symbol.isPublic ? 1 : 0)
+                    << " " << (symbol.isStatic ? 1 : 0)
+                    << "\t" << symbol.name
+                    << "\t" << symbol.type
+                    << "\t" << symbol.containerName << "\n";
+            }
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tmp_path, index_path_, ec);
+    if (ec) {
+        Logger::instance().warning("Cannot replace symbol index " + index_path_ +
+                                   ": " + ec.message());
+        return false;
+    }
+    Logger::instance().debug("Saved symbol index: " + index_path_, "SymbolIndex");
+    return true;
+}
+
+// ============================================================================
+// Updates
+// ============================================================================
+
+void SymbolIndex::updateFile(const std::string& filename,
+                             const std::string& content_hash,
+                             const std::vector<SymbolInfo>& symbols) {
+    FileEntry& entry = files_[filename];
+    entry.hash = content_hash;
+    entry.symbols = symbols;
+    sorted_dirty_ = true;
+}
+
+void SymbolIndex::removeFile(const std::string& filename) {
+    if (files_.erase(filename) > 0) {
+        sorted_dirty_ = true;
+    }
+}
+
+std::string SymbolIndex::hashFor(const std::string& filename) const {
+    auto it = files_.find(filename);
+    return it != files_.end() ? it->second.hash : "";
+}
+
+size_t SymbolIndex::symbolCount() const {
+    size_t count = 0;
+    for (const auto& [filename, entry] : files_) {
+        count += entry.symbols.size();
+    }
+    return count;
+}
+
+// ============================================================================
+// Queries
+// ============================================================================
+
+void SymbolIndex::rebuildSortedView() const {
+    sorted_.clear();
+    for (const auto& [filename, entry] : files_) {
+        for (const auto& symbol : entry.symbols) {
+            sorted_.emplace_back(toLower(symbol.name), &symbol);
+        }
+    }
+    std::sort(sorted_.begin(), sorted_.end(),
+              [](const auto& a, const auto& b) { return a.first < b.first; });
+    sorted_dirty_ = false;
+}
+
+// True when every character of needle appears in haystack in order
+static bool isSubsequence(const std::string& needle, const std::string& haystack) {
+    size_t n = 0;
+    for (size_t h = 0; h < haystack.size() && n < needle.size(); h++) {
+        if (haystack[h] == needle[n]) n++;
+    }
+    return n == needle.size();
+}
+
+std::vector<SymbolInfo> SymbolIndex::query(const std::string& text,
+                                           size_t max_results) const {
+    if (sorted_dirty_) {
+        rebuildSortedView();
+    }
+
+    std::vector<SymbolInfo> results;
+    if (text.empty()) {
+        for (const auto& [name, symbol] : sorted_) {
+            if (results.size() >= max_results) break;
+            results.push_back(*symbol);
+        }
+        return results;
+    }
+
+    std::string needle = toLower(text);
+
+    // Prefix matches first: binary search to the start of the range, then
+    // walk while the prefix holds
+    auto begin = std::lower_bound(sorted_.begin(), sorted_.end(), needle,
+        [](const auto& entry, const std::string& value) {
+            return entry.first < value;
+        });
+    auto prefix_end = begin;
+    while (prefix_end != sorted_.end() &&
+           prefix_end->first.compare(0, needle.size(), needle) == 0) {
+        if (results.size() >= max_results) break;
+        results.push_back(*prefix_end->second);
+        prefix_end++;
+    }
+
+    // Fuzzy (subsequence) matches fill the remainder, skipping the prefix
+    // range already reported
+    for (auto it = sorted_.begin();
+         it != sorted_.end() && results.size() < max_results; ++it) {
+        if (it >= begin && it < prefix_end) continue;
+        if (isSubsequence(needle, it->first)) {
+            results.push_back(*it->second);
+        }
+    }
+    return results;
+}
+
+} // namespace aurora
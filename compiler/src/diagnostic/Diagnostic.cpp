@@ -1,8 +1,8 @@
 #include "aurora/Diagnostic.h"
 #include "aurora/Colors.h"
 #include <iostream>
-#include <sstream>
 #include <iomanip>
+#include <memory>
 
 namespace aurora {
 
@@ -37,31 +37,43 @@ std::string DiagnosticEngine::getLevelColor(DiagnosticLevel level) const {
     return Color::Reset;
 }
 
+void DiagnosticEngine::setSourceCode(std::string_view source) {
+    source_code_ = source;
+    line_offsets_.clear();
+    line_offsets_.push_back(0);
+    for (size_t i = 0; i < source_code_.size(); i++) {
+        if (source_code_[i] == '\n') {
+            line_offsets_.push_back(i + 1);
+        }
+    }
+}
+
 void DiagnosticEngine::printSourceSnippet(const SourceLocation& loc) const {
     if (!loc.isValid() || source_code_.empty()) {
         return;
     }
-    
-    // Split source into lines
-    std::vector<std::string> lines;
-    std::istringstream stream(source_code_);
-    std::string line;
-    while (std::getline(stream, line)) {
-        lines.push_back(line);
-    }
-    
-    if (loc.line == 0 || loc.line > lines.size()) {
+
+    if (loc.line == 0 || loc.line > line_offsets_.size()) {
         return;
     }
-    
+
+    // Slice the line out of the indexed source (no per-diagnostic split)
+    size_t start = line_offsets_[loc.line - 1];
+    size_t end = (loc.line < line_offsets_.size())
+        ? line_offsets_[loc.line] : source_code_.size();
+    std::string_view line_text(source_code_.data() + start, end - start);
+    while (!line_text.empty() &&
+           (line_text.back() == '\n' || line_text.back() == '\r')) {
+        line_text.remove_suffix(1);
+    }
+
     // Print line number and source line
-    size_t line_idx = loc.line - 1;
     if (use_colors_) {
         std::cerr << Color::Blue << std::setw(4) << loc.line << " |" << Color::Reset;
     } else {
         std::cerr << std::setw(4) << loc.line << " |";
     }
-    std::cerr << " " << lines[line_idx] << "\n";
+    std::cerr << " " << line_text << "\n";
     
     // Print the caret pointing to the error location
     if (use_colors_) {
@@ -153,8 +165,9 @@ void DiagnosticEngine::printDiagnostic(const Diagnostic& diag) const {
 }
 
 void DiagnosticEngine::report(const Diagnostic& diag) {
+    std::lock_guard<std::mutex> lock(mutex_);
     diagnostics_.push_back(diag);
-    
+
     switch (diag.getLevel()) {
         case DiagnosticLevel::Error:
         case DiagnosticLevel::Fatal:
@@ -166,14 +179,20 @@ void DiagnosticEngine::report(const Diagnostic& diag) {
         default:
             break;
     }
-    
-    // Print immediately
+
+    // Deferred mode: only the record is kept; the consumer serializes it
+    // itself or renders later via renderAll()
+    if (deferred_) {
+        return;
+    }
+
+    rendered_count_ = diagnostics_.size();
     printDiagnostic(diag);
-    
+
     // In debug mode, print stack trace hint
     if (debug_mode_ && diag.getLevel() >= DiagnosticLevel::Error) {
         if (use_colors_) {
-            std::cerr << Color::Gray << "   [Debug mode enabled - compiler internal state preserved]" 
+            std::cerr << Color::Gray << "   [Debug mode enabled - compiler internal state preserved]"
                       << Color::Reset << "\n\n";
         } else {
             std::cerr << "   [Debug mode enabled - compiler internal state preserved]\n\n";
@@ -181,6 +200,27 @@ void DiagnosticEngine::report(const Diagnostic& diag) {
     }
 }
 
+void DiagnosticEngine::renderAll() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    while (rendered_count_ < diagnostics_.size()) {
+        printDiagnostic(diagnostics_[rendered_count_]);
+        rendered_count_++;
+    }
+}
+
+size_t DiagnosticEngine::getDiagnosticCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return diagnostics_.size();
+}
+
+std::vector<Diagnostic> DiagnosticEngine::getDiagnosticsSince(size_t since) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (since >= diagnostics_.size()) {
+        return {};
+    }
+    return std::vector<Diagnostic>(diagnostics_.begin() + since, diagnostics_.end());
+}
+
 void DiagnosticEngine::reportError(const std::string& code, const std::string& message, 
                                    const SourceLocation& loc) {
     Diagnostic diag(DiagnosticLevel::Error, code, message, loc);
@@ -1,10 +1,189 @@
 #include "aurora/Lexer.h"
 #include "aurora/Diagnostic.h"
+#include <cstring>
 #include <unordered_map>
 
+#if defined(__SSE2__) && (defined(__GNUC__) || defined(__clang__))
+#include <emmintrin.h>
+#define AURORA_LEXER_SSE2 1
+#elif defined(__ARM_NEON) && (defined(__GNUC__) || defined(__clang__))
+#include <arm_neon.h>
+#define AURORA_LEXER_NEON 1
+#endif
+
 namespace aurora {
 
-static const std::unordered_map<std::string, TokenType> keywords = {
+// ---------------------------------------------------------------------------
+// Character-class scanning kernels
+//
+// The hot loops of the lexer (whitespace runs, identifier bodies, string
+// bodies) classify one byte at a time in the scalar version. The kernels
+// below process 16 bytes per iteration with SSE2/NEON and fall back to the
+// scalar loop on other targets. Each returns the length of the leading run
+// of bytes in [p, p+len) that belong to the class.
+// ---------------------------------------------------------------------------
+
+#if AURORA_LEXER_SSE2
+
+/// First index in the 16-byte block whose mask bit is clear, or 16
+static inline size_t firstMiss(int mask) {
+    return mask == 0xFFFF ? 16 : static_cast<size_t>(__builtin_ctz(~mask & 0xFFFF));
+}
+
+static size_t whitespaceRun(const char* p, size_t len) {
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i tab = _mm_set1_epi8('\t');
+    const __m128i nl = _mm_set1_epi8('\n');
+    const __m128i cr = _mm_set1_epi8('\r');
+    size_t i = 0;
+    for (; i + 16 <= len; i += 16) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+        __m128i ws = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(chunk, space), _mm_cmpeq_epi8(chunk, tab)),
+            _mm_or_si128(_mm_cmpeq_epi8(chunk, nl), _mm_cmpeq_epi8(chunk, cr)));
+        size_t miss = firstMiss(_mm_movemask_epi8(ws));
+        if (miss < 16) return i + miss;
+    }
+    while (i < len && (p[i] == ' ' || p[i] == '\t' || p[i] == '\n' || p[i] == '\r')) i++;
+    return i;
+}
+
+static size_t identifierRun(const char* p, size_t len) {
+    // Letters are checked case-folded; bytes >= 0x80 compare negative in
+    // the signed domain and correctly fall out of every range
+    const __m128i case_bit = _mm_set1_epi8(0x20);
+    const __m128i before_a = _mm_set1_epi8('a' - 1);
+    const __m128i after_z = _mm_set1_epi8('z' + 1);
+    const __m128i before_0 = _mm_set1_epi8('0' - 1);
+    const __m128i after_9 = _mm_set1_epi8('9' + 1);
+    const __m128i underscore = _mm_set1_epi8('_');
+    size_t i = 0;
+    for (; i + 16 <= len; i += 16) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+        __m128i folded = _mm_or_si128(chunk, case_bit);
+        __m128i alpha = _mm_and_si128(_mm_cmpgt_epi8(folded, before_a),
+                                      _mm_cmplt_epi8(folded, after_z));
+        __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(chunk, before_0),
+                                      _mm_cmplt_epi8(chunk, after_9));
+        __m128i ident = _mm_or_si128(_mm_or_si128(alpha, digit),
+                                     _mm_cmpeq_epi8(chunk, underscore));
+        size_t miss = firstMiss(_mm_movemask_epi8(ident));
+        if (miss < 16) return i + miss;
+    }
+    while (i < len) {
+        char c = p[i];
+        if (!((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+              (c >= '0' && c <= '9') || c == '_')) break;
+        i++;
+    }
+    return i;
+}
+
+static size_t stringRun(const char* p, size_t len) {
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    size_t i = 0;
+    for (; i + 16 <= len; i += 16) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+        __m128i stop = _mm_or_si128(_mm_cmpeq_epi8(chunk, quote),
+                                    _mm_cmpeq_epi8(chunk, backslash));
+        int mask = _mm_movemask_epi8(stop);
+        if (mask != 0) return i + static_cast<size_t>(__builtin_ctz(mask));
+    }
+    while (i < len && p[i] != '"' && p[i] != '\\') i++;
+    return i;
+}
+
+#elif AURORA_LEXER_NEON
+
+/// First index in the 16-byte block whose mask lane is clear, or 16
+/// (4-bit-per-lane bitmask via the narrowing-shift trick)
+static inline size_t firstMiss(uint8x16_t mask) {
+    uint8x8_t narrowed = vshrn_n_u16(vreinterpretq_u16_u8(mask), 4);
+    uint64_t bits = vget_lane_u64(vreinterpret_u64_u8(narrowed), 0);
+    if (bits == ~0ull) return 16;
+    return static_cast<size_t>(__builtin_ctzll(~bits)) >> 2;
+}
+
+static size_t whitespaceRun(const char* p, size_t len) {
+    size_t i = 0;
+    for (; i + 16 <= len; i += 16) {
+        uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t*>(p + i));
+        uint8x16_t ws = vorrq_u8(
+            vorrq_u8(vceqq_u8(chunk, vdupq_n_u8(' ')), vceqq_u8(chunk, vdupq_n_u8('\t'))),
+            vorrq_u8(vceqq_u8(chunk, vdupq_n_u8('\n')), vceqq_u8(chunk, vdupq_n_u8('\r'))));
+        size_t miss = firstMiss(ws);
+        if (miss < 16) return i + miss;
+    }
+    while (i < len && (p[i] == ' ' || p[i] == '\t' || p[i] == '\n' || p[i] == '\r')) i++;
+    return i;
+}
+
+static size_t identifierRun(const char* p, size_t len) {
+    size_t i = 0;
+    for (; i + 16 <= len; i += 16) {
+        uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t*>(p + i));
+        uint8x16_t folded = vorrq_u8(chunk, vdupq_n_u8(0x20));
+        uint8x16_t alpha = vandq_u8(vcgeq_u8(folded, vdupq_n_u8('a')),
+                                    vcleq_u8(folded, vdupq_n_u8('z')));
+        uint8x16_t digit = vandq_u8(vcgeq_u8(chunk, vdupq_n_u8('0')),
+                                    vcleq_u8(chunk, vdupq_n_u8('9')));
+        uint8x16_t ident = vorrq_u8(vorrq_u8(alpha, digit),
+                                    vceqq_u8(chunk, vdupq_n_u8('_')));
+        size_t miss = firstMiss(ident);
+        if (miss < 16) return i + miss;
+    }
+    while (i < len) {
+        char c = p[i];
+        if (!((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+              (c >= '0' && c <= '9') || c == '_')) break;
+        i++;
+    }
+    return i;
+}
+
+static size_t stringRun(const char* p, size_t len) {
+    size_t i = 0;
+    for (; i + 16 <= len; i += 16) {
+        uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t*>(p + i));
+        uint8x16_t stop = vorrq_u8(vceqq_u8(chunk, vdupq_n_u8('"')),
+                                   vceqq_u8(chunk, vdupq_n_u8('\\')));
+        uint8x16_t keep = vmvnq_u8(stop);
+        size_t miss = firstMiss(keep);
+        if (miss < 16) return i + miss;
+    }
+    while (i < len && p[i] != '"' && p[i] != '\\') i++;
+    return i;
+}
+
+#else // scalar fallback
+
+static size_t whitespaceRun(const char* p, size_t len) {
+    size_t i = 0;
+    while (i < len && (p[i] == ' ' || p[i] == '\t' || p[i] == '\n' || p[i] == '\r')) i++;
+    return i;
+}
+
+static size_t identifierRun(const char* p, size_t len) {
+    size_t i = 0;
+    while (i < len) {
+        char c = p[i];
+        if (!((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+              (c >= '0' && c <= '9') || c == '_')) break;
+        i++;
+    }
+    return i;
+}
+
+static size_t stringRun(const char* p, size_t len) {
+    size_t i = 0;
+    while (i < len && p[i] != '"' && p[i] != '\\') i++;
+    return i;
+}
+
+#endif
+
+static const std::unordered_map<std::string_view, TokenType> keywords = {
     {"fn", TokenType::Fn},
     {"extern", TokenType::Extern},
     {"return", TokenType::Return},
@@ -39,12 +218,15 @@ static const std::unordered_map<std::string, TokenType> keywords = {
 };
 
 std::string Token::toString() const {
-    return "Token(" + value + ", line: " + std::to_string(line) + 
+    return "Token(" + std::string(value) + ", line: " + std::to_string(line) +
            ", col: " + std::to_string(column) + ")";
 }
 
-Lexer::Lexer(std::string src) 
-    : source(std::move(src)), pos(0), line(1), column(1) {}
+Lexer::Lexer(std::string src)
+    : owned_source_(std::move(src)), source(owned_source_), pos(0), line(1), column(1) {}
+
+Lexer::Lexer(std::string_view src)
+    : source(src), pos(0), line(1), column(1) {}
 
 char Lexer::current() const {
     if (isAtEnd()) return '\0';
@@ -68,28 +250,71 @@ void Lexer::advance() {
     }
 }
 
+void Lexer::advanceBy(size_t count) {
+    // Bulk version of advance() for spans the scanning kernels have
+    // already classified; updates line/column without touching each byte
+    const char* begin = source.data() + pos;
+    const char* end = begin + count;
+    const char* cursor = begin;
+    const char* lastNewline = nullptr;
+    size_t newlines = 0;
+    while ((cursor = static_cast<const char*>(
+                std::memchr(cursor, '\n', static_cast<size_t>(end - cursor)))) != nullptr) {
+        lastNewline = cursor;
+        newlines++;
+        cursor++;
+    }
+    if (newlines > 0) {
+        line += newlines;
+        column = static_cast<size_t>(end - lastNewline);
+    } else {
+        column += count;
+    }
+    pos += count;
+}
+
 void Lexer::skipWhitespace() {
-    while (!isAtEnd() && std::isspace(current())) {
-        advance();
+    while (!isAtEnd()) {
+        size_t run = whitespaceRun(source.data() + pos, source.size() - pos);
+        if (run > 0) {
+            advanceBy(run);
+            continue;
+        }
+        // Rare whitespace (\v, \f) not handled by the kernel
+        if (std::isspace(static_cast<unsigned char>(current()))) {
+            advance();
+            continue;
+        }
+        break;
     }
 }
 
 void Lexer::skipComment() {
     // Single-line comment: //
     if (current() == '/' && peek() == '/') {
-        while (!isAtEnd() && current() != '\n') {
-            advance();
-        }
+        const char* start = source.data() + pos;
+        const char* nl = static_cast<const char*>(
+            std::memchr(start, '\n', source.size() - pos));
+        // Stop at the newline (left for skipWhitespace), or consume to EOF
+        advanceBy(nl ? static_cast<size_t>(nl - start) : source.size() - pos);
         return;
     }
-    
+
     // Multi-line comment: /* */
     if (current() == '/' && peek() == '*') {
         advance(); // consume '/'
         advance(); // consume '*'
-        
+
         while (!isAtEnd()) {
-            if (current() == '*' && peek() == '/') {
+            const char* start = source.data() + pos;
+            const char* star = static_cast<const char*>(
+                std::memchr(start, '*', source.size() - pos));
+            if (!star) {
+                advanceBy(source.size() - pos); // unterminated, consume to EOF
+                break;
+            }
+            advanceBy(static_cast<size_t>(star - start));
+            if (peek() == '/') {
                 advance(); // consume '*'
                 advance(); // consume '/'
                 break;
@@ -100,20 +325,22 @@ void Lexer::skipComment() {
     }
 }
 
-Token Lexer::makeToken(TokenType type, std::string value) {
-    return Token(type, std::move(value), line, column);
+Token Lexer::makeToken(TokenType type, std::string_view value) {
+    return Token(type, value, line, column);
 }
 
 Token Lexer::readIdentifierOrKeyword() {
     size_t start = pos;
     size_t startCol = column;
-    
-    while (isAlphaNumeric(current())) {
-        advance();
-    }
-    
-    std::string text = source.substr(start, pos - start);
-    
+
+    // Identifiers contain no newlines, so the whole run advances columns
+    size_t run = identifierRun(source.data() + pos, source.size() - pos);
+    pos += run;
+    column += run;
+
+    // Zero-copy: view straight into the source buffer
+    std::string_view text(source.data() + start, pos - start);
+
     // Check if it's a keyword
     auto it = keywords.find(text);
     if (it != keywords.end()) {
@@ -141,7 +368,7 @@ Token Lexer::readNumber() {
         }
     }
     
-    std::string text = source.substr(start, pos - start);
+    std::string_view text(source.data() + start, pos - start);
     TokenType type = isDouble ? TokenType::DoubleLiteral : TokenType::IntLiteral;
     
     return Token(type, text, line, startCol);
@@ -150,31 +377,44 @@ Token Lexer::readNumber() {
 Token Lexer::readString() {
     size_t startCol = column;
     advance(); // consume opening quote
-    
+    size_t contentStart = pos;
+
     std::string value;
+    bool hasEscapes = false;
     while (!isAtEnd() && current() != '"') {
+        // Fast-forward over the plain body between escapes/quotes
+        size_t run = stringRun(source.data() + pos, source.size() - pos);
+        if (run > 0) {
+            value.append(source.data() + pos, run);
+            advanceBy(run);
+            continue;
+        }
         if (current() == '\\' && peek() == '"') {
             advance(); // consume backslash
             value += '"';
             advance();
+            hasEscapes = true;
         } else if (current() == '\\' && peek() == 'n') {
             advance();
             value += '\n';
             advance();
+            hasEscapes = true;
         } else if (current() == '\\' && peek() == 't') {
             advance();
             value += '\t';
             advance();
+            hasEscapes = true;
         } else if (current() == '\\' && peek() == '\\') {
             advance();
             value += '\\';
             advance();
+            hasEscapes = true;
         } else {
             value += current();
             advance();
         }
     }
-    
+
     if (isAtEnd()) {
         // Unterminated string - report error using diagnostic system
         auto& diag = getDiagnosticEngine();
@@ -182,9 +422,17 @@ Token Lexer::readString() {
         diag.reportError("E1001", "Unterminated string literal", loc);
         return Token(TokenType::Eof, "", line, startCol);
     }
-    
+
     advance(); // consume closing quote
-    return Token(TokenType::StringLiteral, value, line, startCol);
+
+    // Escape-free literals (the common case) view straight into the
+    // source buffer; escaped ones are backed by lexer-owned storage
+    if (!hasEscapes) {
+        std::string_view text(source.data() + contentStart, pos - 1 - contentStart);
+        return Token(TokenType::StringLiteral, text, line, startCol);
+    }
+    string_storage_.push_back(std::move(value));
+    return Token(TokenType::StringLiteral, string_storage_.back(), line, startCol);
 }
 
 Token Lexer::nextToken() {
@@ -296,7 +544,7 @@ Token Lexer::nextToken() {
         case '?': return Token(TokenType::Question, "?", line, startCol);
         case '.': return Token(TokenType::Dot, ".", line, startCol);
         default:
-            return Token(TokenType::Eof, std::string(1, c), line, startCol);
+            return Token(TokenType::Eof, std::string_view(source.data() + pos - 1, 1), line, startCol);
     }
 }
 
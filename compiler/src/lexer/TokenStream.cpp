@@ -0,0 +1,51 @@
+#include "aurora/TokenStream.h"
+#include <algorithm>
+
+namespace aurora {
+
+TokenStream::TokenStream(std::string_view source)
+    : owned_lexer_(std::make_unique<Lexer>(source)) {
+    drain(*owned_lexer_);
+}
+
+TokenStream::TokenStream(Lexer& lexer) {
+    drain(lexer);
+}
+
+void TokenStream::drain(Lexer& lexer) {
+    // The lexer never throws: lexical errors are reported through the
+    // diagnostic engine and surface here as an early Eof token
+    Token token = lexer.nextToken();
+    while (token.type != TokenType::Eof) {
+        tokens_.push_back(token);
+        token = lexer.nextToken();
+    }
+    tokens_.push_back(token);  // keep the Eof so at() can clamp to it
+}
+
+size_t TokenStream::indexAt(size_t line, size_t column) const {
+    // Find the last token starting at or before the position; the Eof
+    // sentinel sorts after every real token
+    auto it = std::upper_bound(
+        tokens_.begin(), tokens_.end(), std::make_pair(line, column),
+        [](const std::pair<size_t, size_t>& pos, const Token& token) {
+            return pos.first < token.line ||
+                   (pos.first == token.line && pos.second < token.column);
+        });
+    if (it == tokens_.begin()) {
+        return npos;
+    }
+    --it;
+    if (it->type == TokenType::Eof || it->line != line ||
+        column >= it->column + std::max<size_t>(it->value.size(), 1)) {
+        return npos;
+    }
+    return static_cast<size_t>(it - tokens_.begin());
+}
+
+const Token* TokenStream::tokenAt(size_t line, size_t column) const {
+    size_t index = indexAt(line, column);
+    return index == npos ? nullptr : &tokens_[index];
+}
+
+} // namespace aurora
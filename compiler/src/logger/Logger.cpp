@@ -1,16 +1,177 @@
 #include "aurora/Logger.h"
 #include "aurora/Colors.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
 #include <iostream>
 #include <iomanip>
+#include <new>
 #include <sstream>
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+// ============================================================================
+// Allocation Counting
+// ============================================================================
+// Replacement global operator new so --time-report can attribute allocation
+// counts to phases without attaching an external profiler. The overhead is a
+// single relaxed atomic increment per allocation, so counting stays on
+// unconditionally.
+
+static std::atomic<uint64_t> g_allocation_count{0};
+
+void* operator new(std::size_t size) {
+    void* ptr = std::malloc(size ? size : 1);
+    if (!ptr) throw std::bad_alloc();
+    g_allocation_count.fetch_add(1, std::memory_order_relaxed);
+    return ptr;
+}
+
+void* operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
 
 namespace aurora {
 
+uint64_t totalAllocationCount() {
+    return g_allocation_count.load(std::memory_order_relaxed);
+}
+
+// Peak resident set size of the process in KB; 0 where unsupported
+static long peakRssKb() {
+#ifndef _WIN32
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#ifdef __APPLE__
+        return static_cast<long>(usage.ru_maxrss / 1024);  // bytes on macOS
+#else
+        return static_cast<long>(usage.ru_maxrss);         // KB on Linux
+#endif
+    }
+#endif
+    return 0;
+}
+
 Logger& Logger::instance() {
     static Logger instance;
     return instance;
 }
 
+Logger::~Logger() {
+    if (flush_thread_.joinable()) {
+        backend_stop_.store(true, std::memory_order_release);
+        queue_cv_.notify_all();
+        flush_thread_.join();
+    }
+    // Drain anything enqueued after the thread saw the stop flag
+    LogRecord record;
+    while (tryDequeue(record)) {
+        writeRecord(record);
+    }
+}
+
+// ============================================================================
+// Async Backend
+// ============================================================================
+// Producers capture records into a bounded ring (Vyukov sequence scheme:
+// each cell carries a sequence number that encodes whether it is free
+// for the current lap) and never touch a stream; the flush thread owns
+// all formatting and I/O. Full ring: the record is dropped and counted -
+// an instrumentation buffer that can stall the compiler would defeat
+// the point.
+
+void Logger::startBackend() {
+    std::call_once(backend_once_, [this] {
+        ring_.reset(new Cell[kRingSize]);
+        for (size_t i = 0; i < kRingSize; i++) {
+            ring_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        flush_thread_ = std::thread(&Logger::flushLoop, this);
+    });
+}
+
+bool Logger::enqueue(LogRecord&& record) {
+    startBackend();
+
+    size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+    Cell* cell;
+    for (;;) {
+        cell = &ring_[pos & (kRingSize - 1)];
+        size_t seq = cell->sequence.load(std::memory_order_acquire);
+        intptr_t dif = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+        if (dif == 0) {
+            if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                                   std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (dif < 0) {
+            dropped_records_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        } else {
+            pos = enqueue_pos_.load(std::memory_order_relaxed);
+        }
+    }
+
+    cell->record = std::move(record);
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    queue_cv_.notify_one();
+    return true;
+}
+
+bool Logger::tryDequeue(LogRecord& record) {
+    if (!ring_) return false;
+    size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+    Cell* cell = &ring_[pos & (kRingSize - 1)];
+    size_t seq = cell->sequence.load(std::memory_order_acquire);
+    if (static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1) < 0) {
+        return false;
+    }
+    record = std::move(cell->record);
+    cell->sequence.store(pos + kRingSize, std::memory_order_release);
+    dequeue_pos_.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+bool Logger::queueEmpty() const {
+    return !ring_ ||
+           dequeue_pos_.load(std::memory_order_acquire) ==
+               enqueue_pos_.load(std::memory_order_acquire);
+}
+
+void Logger::flushLoop() {
+    LogRecord record;
+    while (true) {
+        while (tryDequeue(record)) {
+            std::lock_guard<std::mutex> io_lock(io_mutex_);
+            writeRecord(record);
+        }
+        if (backend_stop_.load(std::memory_order_acquire)) {
+            return;
+        }
+        // The timeout bounds wakeup latency if a notify races the wait
+        std::unique_lock<std::mutex> lock(queue_cv_mutex_);
+        queue_cv_.wait_for(lock, std::chrono::milliseconds(100), [this] {
+            return !queueEmpty() || backend_stop_.load(std::memory_order_acquire);
+        });
+    }
+}
+
+void Logger::flush() {
+    while (!queueEmpty()) {
+        std::this_thread::yield();
+    }
+    // The last record may still be mid-write; synchronize with the writer
+    std::lock_guard<std::mutex> io_lock(io_mutex_);
+    std::cout.flush();
+    std::cerr.flush();
+}
+
 std::string Logger::getLevelString(LogLevel level) const {
     switch (level) {
         case LogLevel::Trace:   return "TRACE";
@@ -39,61 +200,99 @@ std::string Logger::getLevelColor(LogLevel level) const {
     return Color::Reset;
 }
 
-std::string Logger::getCurrentTime() const {
-    auto now = std::chrono::system_clock::now();
-    auto time = std::chrono::system_clock::to_time_t(now);
+std::string Logger::formatTime(std::chrono::system_clock::time_point time_point) const {
+    auto time = std::chrono::system_clock::to_time_t(time_point);
     auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
-        now.time_since_epoch()) % 1000;
-    
+        time_point.time_since_epoch()) % 1000;
+
     std::stringstream ss;
     ss << std::put_time(std::localtime(&time), "%H:%M:%S");
     ss << '.' << std::setfill('0') << std::setw(3) << ms.count();
     return ss.str();
 }
 
-void Logger::log(LogLevel level, const std::string& message, const std::string& component) {
-    if (level < config_.level) return;
-    
-    std::ostream& out = (level >= LogLevel::Error) ? std::cerr : std::cout;
-    
+// Format and write one record; called only on the flush thread or with
+// the queue drained, always under io_mutex_
+void Logger::writeRecord(const LogRecord& record) {
+    std::ostream& out = (record.level >= LogLevel::Error) ? std::cerr : std::cout;
+
+    // Pre-formatted phase banners and dumps
+    if (record.raw) {
+        out << record.message;
+        return;
+    }
+
     // Compact mode for CI/CD
     if (config_.compact_mode) {
-        out << "[" << getLevelString(level) << "] " << message << "\n";
+        out << "[" << getLevelString(record.level) << "] " << record.message << "\n";
         return;
     }
-    
+
     // Colorized output
     if (config_.show_colors) {
-        out << getLevelColor(level) << Color::Bold;
+        out << getLevelColor(record.level) << Color::Bold;
     }
-    
+
     // Timestamp
     if (config_.show_timestamps) {
-        out << "[" << getCurrentTime() << "] ";
+        out << "[" << formatTime(record.time) << "] ";
     }
-    
+
     // Level
-    out << "[" << getLevelString(level) << "]";
-    
+    out << "[" << getLevelString(record.level) << "]";
+
     if (config_.show_colors) {
-        out << Color::Reset << getLevelColor(level);
+        out << Color::Reset << getLevelColor(record.level);
     }
-    
+
     // Component
-    if (!component.empty()) {
-        out << " [" << component << "]";
+    if (!record.component.empty()) {
+        out << " [" << record.component << "]";
     }
-    
+
     // Message
-    out << " " << message;
-    
+    out << " " << record.message;
+
     if (config_.show_colors) {
         out << Color::Reset;
     }
-    
+
     out << "\n";
 }
 
+void Logger::log(LogLevel level, const std::string& message, const std::string& component) {
+    if (level < config_.level) return;
+
+    LogRecord record;
+    record.level = level;
+    record.message = message;
+    record.component = component;
+    record.time = std::chrono::system_clock::now();
+
+    // Warnings and errors write through synchronously, after the queue,
+    // so they stay ordered relative to earlier async records and to
+    // diagnostics emitted directly on stderr
+    if (level >= LogLevel::Warning) {
+        while (!queueEmpty()) {
+            std::this_thread::yield();
+        }
+        std::lock_guard<std::mutex> io_lock(io_mutex_);
+        writeRecord(record);
+        return;
+    }
+
+    enqueue(std::move(record));
+}
+
+// Queue a pre-formatted line (phase banners keep their own layout)
+void Logger::logRaw(LogLevel level, std::string text) {
+    LogRecord record;
+    record.level = level;
+    record.raw = true;
+    record.message = std::move(text);
+    enqueue(std::move(record));
+}
+
 void Logger::trace(const std::string& message, const std::string& component) {
     log(LogLevel::Trace, message, component);
 }
@@ -119,28 +318,128 @@ void Logger::fatal(const std::string& message, const std::string& component) {
 }
 
 void Logger::phaseStart(const std::string& phase_name) {
+    if (collect_metrics_) {
+        // Guarded: module phases may start on worker threads
+        std::lock_guard<std::mutex> lock(log_mutex_);
+        phase_stack_.push_back({phase_name,
+                                std::chrono::steady_clock::now(),
+                                totalAllocationCount()});
+    }
     if (config_.level <= LogLevel::Info) {
+        std::string line;
         if (config_.show_colors) {
-            std::cout << Color::Blue << Color::Bold << "▶ " << Color::Reset;
+            line += Color::Blue;
+            line += Color::Bold;
+            line += "▶ ";
+            line += Color::Reset;
         }
-        std::cout << "[Aurora] Phase: " << phase_name << "\n";
+        line += "[Aurora] Phase: " + phase_name + "\n";
+        logRaw(LogLevel::Info, std::move(line));
     }
 }
 
 void Logger::phaseEnd(const std::string& phase_name, bool success) {
+    if (collect_metrics_) {
+        // Match the innermost open phase with this name; unmatched ends
+        // (e.g. after an error path) are ignored rather than misattributed
+        std::lock_guard<std::mutex> lock(log_mutex_);
+        for (size_t i = phase_stack_.size(); i > 0; i--) {
+            if (phase_stack_[i - 1].name != phase_name) continue;
+            const ActivePhase& active = phase_stack_[i - 1];
+            PhaseMetrics metrics;
+            metrics.name = phase_name;
+            metrics.wall_ms = std::chrono::duration<double, std::milli>(
+                std::chrono::steady_clock::now() - active.start).count();
+            metrics.peak_rss_kb = peakRssKb();
+            metrics.allocations = totalAllocationCount() - active.allocations_at_start;
+            metrics.success = success;
+            phase_metrics_.push_back(std::move(metrics));
+            phase_stack_.erase(phase_stack_.begin() + (i - 1));
+            break;
+        }
+    }
     if (config_.level <= LogLevel::Debug) {
+        std::string line;
         if (config_.show_colors) {
-            std::cout << (success ? Color::Green : Color::Red) << Color::Bold;
-            std::cout << (success ? "✓" : "✗") << Color::Reset << " ";
+            line += (success ? Color::Green : Color::Red);
+            line += Color::Bold;
+            line += (success ? "✓" : "✗");
+            line += Color::Reset;
+            line += " ";
         }
-        std::cout << "Phase " << phase_name << " " 
-                  << (success ? "completed" : "failed") << "\n";
+        line += "Phase " + phase_name + " " +
+                (success ? "completed" : "failed") + "\n";
+        logRaw(LogLevel::Debug, std::move(line));
+    }
+}
+
+void Logger::printPhaseReport() {
+    flush();
+    double total_ms = 0.0;
+    uint64_t total_allocations = 0;
+    size_t name_width = 5;  // "Phase"
+    for (const auto& m : phase_metrics_) {
+        total_ms += m.wall_ms;
+        total_allocations += m.allocations;
+        name_width = std::max(name_width, m.name.size());
+    }
+
+    std::cout << "\n=== Compilation Time Report ===\n";
+    std::cout << std::left << std::setw(static_cast<int>(name_width) + 2) << "Phase"
+              << std::right << std::setw(12) << "Wall (ms)"
+              << std::setw(16) << "Peak RSS (KB)"
+              << std::setw(14) << "Allocations" << "\n";
+    for (const auto& m : phase_metrics_) {
+        std::cout << std::left << std::setw(static_cast<int>(name_width) + 2) << m.name
+                  << std::right << std::setw(12) << std::fixed << std::setprecision(3)
+                  << m.wall_ms
+                  << std::setw(16) << m.peak_rss_kb
+                  << std::setw(14) << m.allocations
+                  << (m.success ? "" : "   (failed)") << "\n";
+    }
+    std::cout << std::left << std::setw(static_cast<int>(name_width) + 2) << "Total"
+              << std::right << std::setw(12) << std::fixed << std::setprecision(3)
+              << total_ms
+              << std::setw(16) << peakRssKb()
+              << std::setw(14) << total_allocations << "\n";
+}
+
+// Minimal JSON string escaping for phase names (quotes and backslashes)
+static std::string escapeJson(const std::string& s) {
+    std::string out;
+    out.reserve(s.size());
+    for (char c : s) {
+        if (c == '"' || c == '\\') out.push_back('\\');
+        out.push_back(c);
+    }
+    return out;
+}
+
+void Logger::writePhaseReportJson(std::ostream& out) {
+    flush();
+    double total_ms = 0.0;
+    for (const auto& m : phase_metrics_) {
+        total_ms += m.wall_ms;
+    }
+
+    out << "{\"phases\":[";
+    for (size_t i = 0; i < phase_metrics_.size(); i++) {
+        const auto& m = phase_metrics_[i];
+        if (i > 0) out << ",";
+        out << "{\"name\":\"" << escapeJson(m.name) << "\""
+            << ",\"wall_ms\":" << std::fixed << std::setprecision(3) << m.wall_ms
+            << ",\"peak_rss_kb\":" << m.peak_rss_kb
+            << ",\"allocations\":" << m.allocations
+            << ",\"success\":" << (m.success ? "true" : "false") << "}";
     }
+    out << "],\"total_wall_ms\":" << std::fixed << std::setprecision(3) << total_ms
+        << ",\"peak_rss_kb\":" << peakRssKb() << "}\n";
 }
 
 void Logger::logAST(const std::string& ast_dump) {
     if (config_.level > LogLevel::Trace) return;
-    
+    flush();
+
     std::cout << Color::Magenta << "=== AST Dump ===" << Color::Reset << "\n";
     std::cout << ast_dump << "\n";
     std::cout << Color::Magenta << "================" << Color::Reset << "\n";
@@ -154,7 +453,8 @@ void Logger::logToken(const std::string& token_info) {
 
 void Logger::logLLVMIR(const std::string& ir_dump) {
     if (config_.level > LogLevel::Trace) return;
-    
+    flush();
+
     std::cout << Color::Cyan << "=== LLVM IR ===" << Color::Reset << "\n";
     std::cout << ir_dump << "\n";
     std::cout << Color::Cyan << "===============" << Color::Reset << "\n";
@@ -162,7 +462,8 @@ void Logger::logLLVMIR(const std::string& ir_dump) {
 
 void Logger::logStatistics(const std::string& stats) {
     if (config_.level > LogLevel::Info) return;
-    
+    flush();
+
     std::cout << Color::Yellow << "=== Statistics ===" << Color::Reset << "\n";
     std::cout << stats << "\n";
     std::cout << Color::Yellow << "==================" << Color::Reset << "\n";
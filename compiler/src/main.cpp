@@ -5,6 +5,7 @@
 #include "aurora/AST.h"
 #include "aurora/Diagnostic.h"
 #include "aurora/Logger.h"
+#include "aurora/SourceBuffer.h"
 #include "aurora/CrashHandler.h"
 #include <iostream>
 #include <fstream>
@@ -20,19 +21,6 @@ using namespace aurora;
 #define AURORA_VERSION_PATCH 3
 #define AURORA_VERSION "0.6.3"
 
-std::string loadFile(const std::string& path) {
-    std::ifstream file(path);
-    if (!file) {
-        auto& diag = getDiagnosticEngine();
-        SourceLocation loc(path, 0, 0, 0);
-        diag.reportError("E0001", "Cannot open file: " + path, loc);
-        return "";
-    }
-    std::stringstream buffer;
-    buffer << file.rdbuf();
-    return buffer.str();
-}
-
 void demonstrateTypeSystem() {
     std::cout << "=== AuroraLang Type System Demo ===" << std::endl;
     
@@ -59,7 +47,7 @@ void demonstrateTypeSystem() {
     std::cout << "  - " << optionalString->toString() << std::endl;
     
     // Function types
-    std::vector<std::shared_ptr<Type>> params = {intType, intType};
+    std::vector<Type*> params = {intType, intType};
     auto funcType = registry.getFunctionType(intType, params);
     
     std::cout << "\nFunction Type:" << std::endl;
@@ -70,7 +58,7 @@ void demonstrateTypeSystem() {
     std::cout << "  - int? is nullable: " << (optionalInt->isNullable() ? "yes" : "no") << std::endl;
 }
 
-void demonstrateLexer(const std::string& source) {
+void demonstrateLexer(std::string_view source) {
     std::cout << "\n=== Lexer Demo ===" << std::endl;
     std::cout << "Source code:\n" << source << std::endl;
     std::cout << "\nTokens:" << std::endl;
@@ -90,13 +78,18 @@ extern "C" double printd(double x) {
     return 0;
 }
 
-int compileAndRun(const std::string& source, const std::string& filename, bool emit_llvm = false, const std::string& output_file = "") {
+int compileAndRun(std::string_view source, const std::string& filename, bool emit_llvm = false, const std::string& output_file = "") {
     auto& diag = getDiagnosticEngine();
     auto& logger = Logger::instance();
     
     diag.setSourceCode(source);
     diag.setFilename(filename);
-    
+
+    // All AST nodes for this compilation live in one arena; declared before
+    // the try block so it outlives the node-owning containers inside it
+    ASTArena ast_arena;
+    ASTArenaScope arena_scope(ast_arena);
+
     try {
         logger.info("Starting compilation...");
         logger.debug("Source file: " + filename, "Compiler");
@@ -217,6 +210,7 @@ int compileAndRun(const std::string& source, const std::string& filename, bool e
         
         // Emit LLVM IR if requested
         if (emit_llvm) {
+            ctx.optimizeModule();
             std::string ll_file = output_file.empty() ? "output.ll" : output_file;
             std::error_code ec;
             llvm::raw_fd_ostream out(ll_file, ec);
@@ -279,9 +273,16 @@ void printUsage(const char* prog) {
     std::cerr << "  --debug                 Enable debug mode (same as --log-level debug)\n";
     std::cerr << "  --trace                 Enable trace mode (most verbose)\n";
     std::cerr << "  --log-level <level>     Set log level: trace|debug|info|warn|error|off\n";
+    std::cerr << "  -O0, -O1, -O2, -O3      Set optimization level (default: -O2)\n";
+    std::cerr << "  --lazy-jit              Compile functions on first call (fast startup)\n";
+    std::cerr << "  --pgo                   Record a run profile and tune later runs with it\n";
+    std::cerr << "  -mcpu <cpu>             Target CPU (default: native; e.g. generic, skylake)\n";
+    std::cerr << "  --no-arc-opt            Disable retain/release elision\n";
     std::cerr << "  --lex                   Show lexer tokens only\n";
     std::cerr << "  --emit-llvm             Emit LLVM IR to file (output.ll)\n";
     std::cerr << "  -o <file>               Specify output file for --emit-llvm\n";
+    std::cerr << "  --time-report           Print per-phase wall time, peak RSS, and allocations\n";
+    std::cerr << "  --time-report-json <f>  Write the per-phase report as JSON to <f>\n";
     std::cerr << "  --type-demo             Show type system demo\n";
     std::cerr << "\nLog Levels:\n";
     std::cerr << "  trace  - Show all debug information including AST and IR\n";
@@ -314,7 +315,9 @@ int main(int argc, char** argv) {
     bool emit_llvm = false;
     bool type_demo = false;
     bool debug_mode = false;
+    bool time_report = false;
     std::string output_file;
+    std::string time_report_json;
     
     for (int i = 1; i < argc; ++i) {
         std::string arg = argv[i];
@@ -349,6 +352,21 @@ int main(int argc, char** argv) {
                 std::cerr << "Error: --log-level requires an argument\n";
                 return 1;
             }
+        } else if (arg == "-O0" || arg == "-O1" || arg == "-O2" || arg == "-O3") {
+            getGlobalContext().setOptimizationLevel(arg[2] - '0');
+        } else if (arg == "--lazy-jit") {
+            getGlobalContext().setLazyJIT(true);
+        } else if (arg == "--pgo") {
+            getGlobalContext().setProfileGuidedJIT(true);
+        } else if (arg == "-mcpu" || arg == "--mcpu") {
+            if (i + 1 < argc) {
+                getGlobalContext().setTargetCPU(argv[++i]);
+            } else {
+                std::cerr << "Error: -mcpu requires an argument\n";
+                return 1;
+            }
+        } else if (arg == "--no-arc-opt") {
+            getGlobalContext().setARCOptEnabled(false);
         } else if (arg == "--lex") {
             lex_only = true;
         } else if (arg == "--emit-llvm") {
@@ -360,6 +378,17 @@ int main(int argc, char** argv) {
                 std::cerr << "Error: -o requires an argument\n";
                 return 1;
             }
+        } else if (arg == "--time-report") {
+            time_report = true;
+            Logger::instance().enablePhaseMetrics();
+        } else if (arg == "--time-report-json") {
+            if (i + 1 < argc) {
+                time_report_json = argv[++i];
+                Logger::instance().enablePhaseMetrics();
+            } else {
+                std::cerr << "Error: --time-report-json requires an argument\n";
+                return 1;
+            }
         } else if (arg == "--type-demo") {
             type_demo = true;
         } else if (arg[0] != '-') {
@@ -383,10 +412,16 @@ int main(int argc, char** argv) {
         return 1;
     }
     
-    std::string source = loadFile(filename);
-    if (source.empty()) {
+    // Sources are memory-mapped; the buffer must stay alive for as long
+    // as the Lexer's tokens are in use
+    auto source_buffer = SourceBuffer::open(filename);
+    if (!source_buffer) {
+        auto& diag = getDiagnosticEngine();
+        SourceLocation loc(filename, 0, 0, 0);
+        diag.reportError("E0001", "Cannot open file: " + filename, loc);
         return 1;
     }
+    std::string_view source = source_buffer->contents();
     
     if (lex_only) {
         demonstrateLexer(source);
@@ -397,6 +432,20 @@ int main(int argc, char** argv) {
     int exit_code = compileAndRun(source, filename, emit_llvm, output_file);
     std::cout.flush();
     std::cerr.flush();
+
+    // Emit per-phase timing/memory report if requested
+    auto& logger = Logger::instance();
+    if (time_report) {
+        logger.printPhaseReport();
+    }
+    if (!time_report_json.empty()) {
+        std::ofstream json_out(time_report_json);
+        if (json_out) {
+            logger.writePhaseReportJson(json_out);
+        } else {
+            logger.error("Could not write time report to: " + time_report_json);
+        }
+    }
     
     // Print diagnostic summary
     auto& diag = getDiagnosticEngine();
@@ -4,14 +4,34 @@
 
 namespace aurora {
 
-Parser::Parser(Lexer& lexer) 
-    : lexer_(lexer), 
+Parser::Parser(Lexer& lexer)
+    : owned_tokens_(std::make_unique<TokenStream>(lexer)),
+      tokens_(owned_tokens_.get()),
+      current_token_(TokenType::Eof, "", 0, 0) {
+    advance(); // Load first token
+}
+
+Parser::Parser(const TokenStream& tokens)
+    : tokens_(&tokens),
       current_token_(TokenType::Eof, "", 0, 0) {
     advance(); // Load first token
 }
 
 void Parser::advance() {
-    current_token_ = lexer_.nextToken();
+    current_token_ = tokens_->at(pos_);
+    if (pos_ < tokens_->size()) {
+        pos_++;
+    }
+}
+
+const Token& Parser::lookahead(size_t distance) const {
+    // pos_ already points one past the current token
+    return tokens_->at(pos_ + distance - 1);
+}
+
+void Parser::rewindTo(size_t mark) {
+    pos_ = mark;
+    current_token_ = tokens_->at(pos_ == 0 ? 0 : pos_ - 1);
 }
 
 bool Parser::match(TokenType type) {
@@ -47,7 +67,7 @@ void Parser::error(const std::string& message) {
     // Report the error through diagnostic system
     std::string full_message = message;
     if (!current_token_.value.empty()) {
-        full_message += " (got '" + current_token_.value + "')";
+        full_message += " (got '" + std::string(current_token_.value) + "')";
     }
     
     diag.reportError("E2001", full_message, loc);
@@ -165,7 +185,7 @@ std::unique_ptr<Prototype> Parser::parseExtern() {
     if (current_token_.type != TokenType::Identifier) {
         error("Expected function name after 'extern'");
     }
-    std::string name = current_token_.value;
+    std::string name(current_token_.value);
     advance();
     
     expect(TokenType::LeftParen, "Expected '(' after function name");
@@ -176,7 +196,7 @@ std::unique_ptr<Prototype> Parser::parseExtern() {
             if (current_token_.type != TokenType::Identifier) {
                 error("Expected parameter name");
             }
-            std::string param_name = current_token_.value;
+            std::string param_name(current_token_.value);
             advance();
             
             // For extern functions, assume double type (legacy compatibility)
@@ -210,7 +230,7 @@ std::unique_ptr<Function> Parser::parseFunction() {
     
     // Add function parameters to local types
     for (const auto& param : proto->getParams()) {
-        local_types_[param.name] = param.type;
+        local_types_.insert(param.name, param.type);
     }
     
     auto body = parseBlock();
@@ -222,7 +242,7 @@ std::unique_ptr<Prototype> Parser::parsePrototype() {
     if (current_token_.type != TokenType::Identifier) {
         error("Expected function name");
     }
-    std::string name = current_token_.value;
+    std::string name(current_token_.value);
     size_t funcLine = current_token_.line;
     size_t funcColumn = current_token_.column;
     advance();
@@ -235,11 +255,11 @@ std::unique_ptr<Prototype> Parser::parsePrototype() {
             if (current_token_.type != TokenType::Identifier) {
                 error("Expected parameter name");
             }
-            std::string param_name = current_token_.value;
+            std::string param_name(current_token_.value);
             advance();
             
             // Type annotation is optional in basic syntax
-            std::shared_ptr<Type> param_type;
+            Type* param_type;
             if (match(TokenType::Colon)) {
                 param_type = parseType();
             } else {
@@ -256,7 +276,7 @@ std::unique_ptr<Prototype> Parser::parsePrototype() {
     expect(TokenType::RightParen, "Expected ')' after parameters");
     
     // Return type annotation (optional)
-    std::shared_ptr<Type> return_type;
+    Type* return_type;
     if (match(TokenType::Arrow)) {
         return_type = parseType();
     } else {
@@ -296,6 +316,8 @@ std::unique_ptr<Stmt> Parser::parseStatement() {
         return parseVarDecl();
     } else if (current_token_.type == TokenType::If) {
         return parseIfStatement();
+    } else if (current_token_.type == TokenType::Match) {
+        return parseMatchStatement();
     } else if (current_token_.type == TokenType::While) {
         return parseWhileStatement();
     } else if (current_token_.type == TokenType::For) {
@@ -351,11 +373,11 @@ std::unique_ptr<Stmt> Parser::parseVarDecl() {
     if (current_token_.type != TokenType::Identifier) {
         error("Expected variable name");
     }
-    std::string name = current_token_.value;
+    std::string name(current_token_.value);
     advance();
     
     // Type annotation (optional)
-    std::shared_ptr<Type> var_type;
+    Type* var_type;
     if (match(TokenType::Colon)) {
         var_type = parseType();
     }
@@ -374,7 +396,7 @@ std::unique_ptr<Stmt> Parser::parseVarDecl() {
     }
     
     // Record variable type in local symbol table
-    local_types_[name] = var_type;
+    local_types_.insert(name, var_type);
     
     match(TokenType::Semicolon); // Optional semicolon
     return std::make_unique<VarDeclStmt>(name, var_type, std::move(init), is_mutable);
@@ -402,6 +424,45 @@ std::unique_ptr<Stmt> Parser::parseIfStatement() {
                                     std::move(elseBranch));
 }
 
+std::unique_ptr<Stmt> Parser::parseMatchStatement() {
+    expect(TokenType::Match, "Expected 'match'");
+
+    auto subject = parseExpression();
+    expect(TokenType::LeftBrace, "Expected '{' after match subject");
+
+    std::vector<MatchArm> arms;
+    std::vector<std::unique_ptr<Stmt>> defaultBody;
+    bool hasDefault = false;
+
+    while (current_token_.type != TokenType::RightBrace &&
+           current_token_.type != TokenType::Eof) {
+        if (current_token_.type == TokenType::Else) {
+            if (hasDefault) {
+                error("Match statement has more than one 'else' arm");
+            }
+            advance();
+            expect(TokenType::Arrow, "Expected '->' after 'else' in match");
+            defaultBody = parseBlock();
+            hasDefault = true;
+            continue;
+        }
+
+        // One or more comma-separated patterns sharing a body
+        MatchArm arm;
+        do {
+            arm.patterns.push_back(parseExpression());
+        } while (match(TokenType::Comma));
+
+        expect(TokenType::Arrow, "Expected '->' after match pattern");
+        arm.body = parseBlock();
+        arms.push_back(std::move(arm));
+    }
+
+    expect(TokenType::RightBrace, "Expected '}'");
+    return std::make_unique<MatchStmt>(std::move(subject), std::move(arms),
+                                       std::move(defaultBody));
+}
+
 std::unique_ptr<Stmt> Parser::parseWhileStatement() {
     expect(TokenType::While, "Expected 'while'");
     
@@ -418,7 +479,7 @@ std::unique_ptr<Stmt> Parser::parseForStatement() {
     if (current_token_.type != TokenType::Identifier) {
         error("Expected loop variable name after 'for'");
     }
-    std::string varName = current_token_.value;
+    std::string varName(current_token_.value);
     advance();
     
     expect(TokenType::In, "Expected 'in' after loop variable");
@@ -655,21 +716,21 @@ std::unique_ptr<Expr> Parser::parsePrimary() {
     // Number literal (int or double)
     if (current_token_.type == TokenType::IntLiteral) {
         // Integer literal
-        int64_t value = std::stoll(current_token_.value);
+        int64_t value = std::stoll(std::string(current_token_.value));
         advance();
         return std::make_unique<IntLiteralExpr>(value);
     }
     
     if (current_token_.type == TokenType::DoubleLiteral) {
         // Double literal
-        double value = std::stod(current_token_.value);
+        double value = std::stod(std::string(current_token_.value));
         advance();
         return std::make_unique<DoubleLiteralExpr>(value);
     }
     
     // String literal
     if (current_token_.type == TokenType::StringLiteral) {
-        std::string value = current_token_.value;
+        std::string value(current_token_.value);
         advance();
         return std::make_unique<StringExpr>(value);
     }
@@ -701,7 +762,7 @@ std::unique_ptr<Expr> Parser::parsePrimary() {
             if (current_token_.type != TokenType::Identifier) {
                 error("Expected member name after '.'");
             }
-            std::string memberName = current_token_.value;
+            std::string memberName(current_token_.value);
             advance();
             
             // Check if it's a method call
@@ -729,7 +790,7 @@ std::unique_ptr<Expr> Parser::parsePrimary() {
     
     // Identifier or function call
     if (current_token_.type == TokenType::Identifier) {
-        std::string name = current_token_.value;
+        std::string name(current_token_.value);
         advance();
         
         if (current_token_.type == TokenType::LeftParen) {
@@ -741,7 +802,7 @@ std::unique_ptr<Expr> Parser::parsePrimary() {
                 if (current_token_.type != TokenType::Identifier) {
                     error("Expected member name after '.'");
                 }
-                std::string memberName = current_token_.value;
+                std::string memberName(current_token_.value);
                 advance();
                 
                 auto& registry = TypeRegistry::instance();
@@ -767,11 +828,10 @@ std::unique_ptr<Expr> Parser::parsePrimary() {
         } else {
             // Variable reference - try to find type from local symbol table
             auto& registry = TypeRegistry::instance();
-            std::shared_ptr<Type> varType = registry.getIntType(); // Default placeholder
+            Type* varType = registry.getIntType(); // Default placeholder
             
-            auto it = local_types_.find(name);
-            if (it != local_types_.end()) {
-                varType = it->second;
+            if (Type* localType = local_types_.lookup(name)) {
+                varType = localType;
             }
             
             std::unique_ptr<Expr> varExpr = std::make_unique<VariableExpr>(name, varType);
@@ -782,7 +842,7 @@ std::unique_ptr<Expr> Parser::parsePrimary() {
                 if (current_token_.type != TokenType::Identifier) {
                     error("Expected member name after '.'");
                 }
-                std::string memberName = current_token_.value;
+                std::string memberName(current_token_.value);
                 advance();
                 
                 if (current_token_.type == TokenType::LeftParen) {
@@ -823,7 +883,7 @@ std::unique_ptr<Expr> Parser::parsePrimary() {
         
         // Infer element type from first element
         auto& registry = TypeRegistry::instance();
-        std::shared_ptr<Type> elemType;
+        Type* elemType;
         if (!elements.empty()) {
             elemType = elements[0]->getType();
         } else {
@@ -866,48 +926,48 @@ std::unique_ptr<Expr> Parser::parseCall(std::string callee) {
     }
     
     // Otherwise it's a regular function call
-    std::shared_ptr<Type> return_type = registry.getDoubleType();
+    Type* return_type = registry.getDoubleType();
     return std::make_unique<CallExpr>(callee, std::move(args), return_type);
 }
 
-std::shared_ptr<Type> Parser::parseType() {
+Type* Parser::parseType() {
     auto& registry = TypeRegistry::instance();
     
     // Handle array types [ElementType]
     if (current_token_.type == TokenType::LeftBracket) {
         advance(); // consume '['
-        std::shared_ptr<Type> elementType = parseType(); // recursively parse element type
+        Type* elementType = parseType(); // recursively parse element type
         expect(TokenType::RightBracket, "Expected ']' after array element type");
         
         bool is_optional = match(TokenType::Question);
-        std::shared_ptr<Type> arrayType = registry.getArrayType(elementType);
-        return is_optional ? std::shared_ptr<Type>(registry.getOptionalType(arrayType)) : arrayType;
+        Type* arrayType = registry.getArrayType(elementType);
+        return is_optional ? static_cast<Type*>(registry.getOptionalType(arrayType)) : arrayType;
     }
     
     // Handle built-in types
     if (current_token_.type == TokenType::TypeInt) {
         advance();
         bool is_optional = match(TokenType::Question);
-        std::shared_ptr<Type> type = registry.getIntType();
-        return is_optional ? std::shared_ptr<Type>(registry.getOptionalType(type)) : type;
+        Type* type = registry.getIntType();
+        return is_optional ? static_cast<Type*>(registry.getOptionalType(type)) : type;
     }
     if (current_token_.type == TokenType::TypeDouble) {
         advance();
         bool is_optional = match(TokenType::Question);
-        std::shared_ptr<Type> type = registry.getDoubleType();
-        return is_optional ? std::shared_ptr<Type>(registry.getOptionalType(type)) : type;
+        Type* type = registry.getDoubleType();
+        return is_optional ? static_cast<Type*>(registry.getOptionalType(type)) : type;
     }
     if (current_token_.type == TokenType::TypeBool) {
         advance();
         bool is_optional = match(TokenType::Question);
-        std::shared_ptr<Type> type = registry.getBoolType();
-        return is_optional ? std::shared_ptr<Type>(registry.getOptionalType(type)) : type;
+        Type* type = registry.getBoolType();
+        return is_optional ? static_cast<Type*>(registry.getOptionalType(type)) : type;
     }
     if (current_token_.type == TokenType::TypeString) {
         advance();
         bool is_optional = match(TokenType::Question);
-        std::shared_ptr<Type> type = registry.getStringType();
-        return is_optional ? std::shared_ptr<Type>(registry.getOptionalType(type)) : type;
+        Type* type = registry.getStringType();
+        return is_optional ? static_cast<Type*>(registry.getOptionalType(type)) : type;
     }
     if (current_token_.type == TokenType::TypeVoid) {
         advance();
@@ -919,7 +979,7 @@ std::shared_ptr<Type> Parser::parseType() {
         advance(); // consume 'fn'
         expect(TokenType::LeftParen, "Expected '(' after 'fn'");
         
-        std::vector<std::shared_ptr<Type>> paramTypes;
+        std::vector<Type*> paramTypes;
         if (current_token_.type != TokenType::RightParen) {
             do {
                 paramTypes.push_back(parseType());
@@ -928,7 +988,7 @@ std::shared_ptr<Type> Parser::parseType() {
         
         expect(TokenType::RightParen, "Expected ')' after function parameters");
         
-        std::shared_ptr<Type> returnType;
+        Type* returnType;
         if (match(TokenType::Arrow)) {
             returnType = parseType();
         } else {
@@ -940,15 +1000,15 @@ std::shared_ptr<Type> Parser::parseType() {
     
     // Handle identifiers (could be class names)
     if (current_token_.type == TokenType::Identifier) {
-        std::string type_name = current_token_.value;
+        std::string type_name(current_token_.value);
         advance();
         
         // Check for optional marker (?)
         bool is_optional = match(TokenType::Question);
         
         // Try class type
-        std::shared_ptr<Type> type = registry.getClassType(type_name);
-        return is_optional ? std::shared_ptr<Type>(registry.getOptionalType(type)) : type;
+        Type* type = registry.getClassType(type_name);
+        return is_optional ? static_cast<Type*>(registry.getOptionalType(type)) : type;
     }
     
     error("Expected type name");
@@ -975,7 +1035,7 @@ std::unique_ptr<ClassDecl> Parser::parseClassOrObject(bool isSingleton) {
     if (current_token_.type != TokenType::Identifier) {
         error("Expected class/object name");
     }
-    std::string className = current_token_.value;
+    std::string className(current_token_.value);
     size_t classLine = current_token_.line;
     size_t classColumn = current_token_.column;
     advance();
@@ -1019,12 +1079,12 @@ std::unique_ptr<ClassDecl> Parser::parseClassOrObject(bool isSingleton) {
                 if (current_token_.type != TokenType::Identifier) {
                     error("Expected parameter name in primary constructor");
                 }
-                std::string fieldName = current_token_.value;
+                std::string fieldName(current_token_.value);
                 advance();
                 
                 // Expect colon and type
                 expect(TokenType::Colon, "Expected ':' after parameter name");
-                std::shared_ptr<Type> fieldType = parseType();
+                Type* fieldType = parseType();
                 
                 // Add as field
                 fields.push_back(FieldDecl(fieldName, fieldType, isPublic, nullptr));
@@ -1126,7 +1186,7 @@ FieldDecl Parser::parseField(bool isPublic) {
     if (current_token_.type != TokenType::Identifier) {
         error("Expected field name");
     }
-    std::string fieldName = current_token_.value;
+    std::string fieldName(current_token_.value);
     advance();
     
     expect(TokenType::Colon, "Expected ':' after field name");
@@ -1144,12 +1204,23 @@ FieldDecl Parser::parseField(bool isPublic) {
     return FieldDecl(fieldName, fieldType, isPublic, std::move(initializer));
 }
 
-std::shared_ptr<Type> Parser::inferMethodReturnType(const std::shared_ptr<Type>& objType, 
+Type* Parser::inferMethodReturnType(Type* objType,
                                                      const std::string& methodName) {
     auto& registry = TypeRegistry::instance();
-    
+
+    // Built-in array methods (lowered in ArrayCodeGen.cpp)
+    if (dynamic_cast<ArrayType*>(objType)) {
+        if (methodName == "size") {
+            return registry.getIntType();
+        }
+        if (methodName == "append" || methodName == "reserve" ||
+            methodName == "shrinkToFit") {
+            return registry.getVoidType();
+        }
+    }
+
     // Check if the object type is a class type
-    auto classType = std::dynamic_pointer_cast<ClassType>(objType);
+    auto classType = dynamic_cast<ClassType*>(objType);
     if (!classType) {
         return registry.getDoubleType(); // Fallback
     }
@@ -1204,10 +1275,10 @@ MethodDecl Parser::parseMethod(bool isPublic) {
             if (current_token_.type != TokenType::Identifier) {
                 error("Expected parameter name");
             }
-            std::string paramName = current_token_.value;
+            std::string paramName(current_token_.value);
             advance();
             
-            std::shared_ptr<Type> paramType;
+            Type* paramType;
             if (match(TokenType::Colon)) {
                 paramType = parseType();
             } else {
@@ -1226,7 +1297,7 @@ MethodDecl Parser::parseMethod(bool isPublic) {
     }
     
     // Parse return type
-    std::shared_ptr<Type> returnType;
+    Type* returnType;
     if (match(TokenType::Arrow)) {
         returnType = parseType();
     } else {
@@ -1239,7 +1310,7 @@ MethodDecl Parser::parseMethod(bool isPublic) {
     
     // Add method parameters to local types
     for (const auto& param : params) {
-        local_types_[param.name] = param.type;
+        local_types_.insert(param.name, param.type);
     }
     
     // Parse method body
@@ -95,7 +95,7 @@ std::string OptionalType::getMangledName() const {
 bool OptionalType::equals(const Type* other) const {
     if (!other || !other->isOptional()) return false;
     const OptionalType* opt = static_cast<const OptionalType*>(other);
-    return innerType->equals(opt->innerType.get());
+    return innerType->equals(opt->innerType);
 }
 
 // FunctionType implementation
@@ -134,9 +134,9 @@ bool FunctionType::equals(const Type* other) const {
     if (!other || !other->isFunction()) return false;
     const FunctionType* func = static_cast<const FunctionType*>(other);
     if (paramTypes.size() != func->paramTypes.size()) return false;
-    if (!returnType->equals(func->returnType.get())) return false;
+    if (!returnType->equals(func->returnType)) return false;
     for (size_t i = 0; i < paramTypes.size(); i++) {
-        if (!paramTypes[i]->equals(func->paramTypes[i].get())) return false;
+        if (!paramTypes[i]->equals(func->paramTypes[i])) return false;
     }
     return true;
 }
@@ -147,52 +147,43 @@ TypeRegistry& TypeRegistry::instance() {
     return registry;
 }
 
-std::shared_ptr<VoidType> TypeRegistry::getVoidType() {
-    if (!voidType) voidType = std::make_shared<VoidType>();
-    return voidType;
-}
-
-std::shared_ptr<IntType> TypeRegistry::getIntType() {
-    if (!intType) intType = std::make_shared<IntType>();
-    return intType;
-}
-
-std::shared_ptr<DoubleType> TypeRegistry::getDoubleType() {
-    if (!doubleType) doubleType = std::make_shared<DoubleType>();
-    return doubleType;
-}
-
-std::shared_ptr<BoolType> TypeRegistry::getBoolType() {
-    if (!boolType) boolType = std::make_shared<BoolType>();
-    return boolType;
-}
-
-std::shared_ptr<StringType> TypeRegistry::getStringType() {
-    if (!stringType) stringType = std::make_shared<StringType>();
-    return stringType;
+OptionalType* TypeRegistry::getOptionalType(Type* inner) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& slot = optionalTypes[inner];
+    if (!slot) {
+        slot = std::make_unique<OptionalType>(inner);
+    }
+    return slot.get();
 }
 
-std::shared_ptr<OptionalType> TypeRegistry::getOptionalType(std::shared_ptr<Type> inner) {
-    return std::make_shared<OptionalType>(std::move(inner));
-}
+FunctionType* TypeRegistry::getFunctionType(Type* ret, std::vector<Type*> params) {
+    // Keyed by the mangled signature; cheaper than a structural compare
+    // and stable across calls
+    std::string key = "f";
+    for (const auto* param : params) {
+        key += param->getMangledName();
+    }
+    key += "r" + ret->getMangledName();
 
-std::shared_ptr<FunctionType> TypeRegistry::getFunctionType(
-    std::shared_ptr<Type> ret, 
-    std::vector<std::shared_ptr<Type>> params) {
-    return std::make_shared<FunctionType>(std::move(ret), std::move(params));
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& slot = functionTypes[key];
+    if (!slot) {
+        slot = std::make_unique<FunctionType>(ret, std::move(params));
+    }
+    return slot.get();
 }
 
-std::shared_ptr<ClassType> TypeRegistry::getClassType(const std::string& name) {
-    auto it = classTypes.find(name);
-    if (it != classTypes.end()) {
-        return it->second;
+ClassType* TypeRegistry::getClassType(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& slot = classTypes[name];
+    if (!slot) {
+        slot = std::make_unique<ClassType>(name);
     }
-    auto classType = std::make_shared<ClassType>(name);
-    classTypes[name] = classType;
-    return classType;
+    return slot.get();
 }
 
 bool TypeRegistry::hasClassType(const std::string& name) const {
+    std::lock_guard<std::mutex> lock(mutex_);
     return classTypes.find(name) != classTypes.end();
 }
 
@@ -216,7 +207,7 @@ std::string ArrayType::getMangledName() const {
 bool ArrayType::equals(const Type* other) const {
     if (!other || !other->isArray()) return false;
     const ArrayType* arr = static_cast<const ArrayType*>(other);
-    return elementType->equals(arr->elementType.get());
+    return elementType->equals(arr->elementType);
 }
 
 // ClassType implementation
@@ -237,8 +228,13 @@ bool ClassType::equals(const Type* other) const {
     return name == cls->name;
 }
 
-std::shared_ptr<ArrayType> TypeRegistry::getArrayType(std::shared_ptr<Type> elementType) {
-    return std::make_shared<ArrayType>(std::move(elementType));
+ArrayType* TypeRegistry::getArrayType(Type* elementType) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& slot = arrayTypes[elementType];
+    if (!slot) {
+        slot = std::make_unique<ArrayType>(elementType);
+    }
+    return slot.get();
 }
 
 } // namespace aurora
@@ -0,0 +1,66 @@
+#include "aurora/SourceBuffer.h"
+#include "aurora/Logger.h"
+#include <fstream>
+#include <sstream>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace aurora {
+
+std::unique_ptr<SourceBuffer> SourceBuffer::open(const std::string& path) {
+#ifndef _WIN32
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd >= 0) {
+        struct stat st;
+        if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+            void* mapping = mmap(nullptr, static_cast<size_t>(st.st_size),
+                                 PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapping != MAP_FAILED) {
+                close(fd);
+                auto buffer = std::unique_ptr<SourceBuffer>(new SourceBuffer());
+                buffer->path_ = path;
+                buffer->data_ = static_cast<const char*>(mapping);
+                buffer->size_ = static_cast<size_t>(st.st_size);
+                buffer->mapped_ = true;
+                Logger::instance().debug("Mapped source file: " + path + " (" +
+                                         std::to_string(buffer->size_) + " bytes)", "SourceBuffer");
+                return buffer;
+            }
+        }
+        close(fd);
+    }
+#endif
+
+    // Fallback: plain read (empty files, pipes, or no mmap support)
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return nullptr;
+    }
+    std::stringstream contents;
+    contents << file.rdbuf();
+    return fromString(contents.str(), path);
+}
+
+std::unique_ptr<SourceBuffer> SourceBuffer::fromString(std::string contents, std::string path) {
+    auto buffer = std::unique_ptr<SourceBuffer>(new SourceBuffer());
+    buffer->path_ = std::move(path);
+    buffer->owned_ = std::move(contents);
+    buffer->data_ = buffer->owned_.data();
+    buffer->size_ = buffer->owned_.size();
+    return buffer;
+}
+
+SourceBuffer::~SourceBuffer() {
+#ifndef _WIN32
+    if (mapped_) {
+        munmap(const_cast<char*>(data_), size_);
+    }
+#endif
+}
+
+} // namespace aurora
@@ -21,17 +21,35 @@ typedef enum {
     AURORA_TYPE_STRING = 3
 } AuroraObjectType;
 
+// Reference-count state flags
+// Objects start thread-confined: retain/release use plain arithmetic.
+// Marking an object shared (before handing it to another thread) flips
+// its refcount to atomic operations; thread-local objects keep paying
+// nothing for synchronization.
+#define AURORA_RC_FLAG_SHARED 0x1u
+
+// Immortal objects live in constant data emitted by the compiler
+// (interned string literals); retain/release/mark-shared must not touch
+// them - the memory may be read-only and is never deallocated
+#define AURORA_RC_FLAG_IMMORTAL 0x2u
+
 // Reference counting header for all heap-allocated objects
 typedef struct {
     int64_t ref_count;
     AuroraObjectType type;
+    uint32_t flags;
 } AuroraRefCountHeader;
 
 // Array Runtime Support
+// Elements live inline after the length, so an array is one allocation
+// and a subscript needs no pointer chase through a separate data block.
+// Arrays are growable: capacity tracks how many elements the allocation
+// can hold, so append is a bounds compare plus store until it runs out.
 typedef struct {
     AuroraRefCountHeader header;
     int64_t length;
-    void* data;
+    int64_t capacity;  // elements the allocation can hold without growing
+    char data[];       // elements, contiguous
 } AuroraArray;
 
 // Create a new array with given element size and count
@@ -52,6 +70,20 @@ void aurora_array_set(AuroraArray* array, int64_t index, void* element, int64_t
 // Bounds checking (debug mode)
 void aurora_array_bounds_check(AuroraArray* array, int64_t index);
 
+// Append one element, doubling the capacity when the array is full.
+// Growth MOVES the allocation: callers must adopt the returned pointer
+// and stop using the old one (the compiler reloads length and data
+// through the return value).
+AuroraArray* aurora_array_append(AuroraArray* array, const void* element, int64_t element_size);
+
+// Grow capacity to at least `min_capacity` elements ahead of a known
+// run of appends; returns the (possibly moved) array
+AuroraArray* aurora_array_reserve(AuroraArray* array, int64_t min_capacity, int64_t element_size);
+
+// Trim spare capacity back to the current length; returns the
+// (possibly moved) array
+AuroraArray* aurora_array_shrink_to_fit(AuroraArray* array, int64_t element_size);
+
 // Object/Class Runtime Support
 typedef struct {
     AuroraRefCountHeader header;
@@ -67,26 +99,78 @@ AuroraObject* aurora_object_create(size_t size);
 void aurora_object_free(AuroraObject* obj);
 
 // String Runtime Support
+// Length-prefixed with the bytes inline after the header, so a string
+// is one allocation and length queries are O(1). The bytes always carry
+// a trailing NUL beyond `length`, which keeps `data` usable as a plain
+// C string at FFI boundaries (file paths, getenv, ...).
 typedef struct {
     AuroraRefCountHeader header;
-    int64_t length;
-    char* data;
+    int64_t length;  // bytes, excluding the trailing NUL
+    char data[];     // bytes plus trailing NUL
 } AuroraString;
 
+// Create a string by copying a NUL-terminated C string
 AuroraString* aurora_string_create(const char* str);
+
+// Create a string of `length` bytes copied from `bytes` (which need not
+// be NUL-terminated); pass NULL to leave the bytes uninitialized for
+// callers that fill them in afterwards
+AuroraString* aurora_string_create_len(const char* bytes, int64_t length);
+
 void aurora_string_free(AuroraString* str);
 int64_t aurora_string_length(AuroraString* str);
 
+// FNV-1a hash of the string bytes; the compiler relies on this to build
+// hashed dispatch for string match statements
+uint64_t aurora_string_hash(AuroraString* str);
+
+// String Builder
+// Growable byte buffer for assembling a string across many appends.
+// Appending amortizes to O(1) via capacity doubling, and the result is
+// materialized exactly once; building a string of n pieces is O(total
+// bytes) instead of the O(n^2) that repeated concatenation costs.
+typedef struct {
+    char* data;
+    int64_t length;
+    int64_t capacity;
+} AuroraStringBuilder;
+
+AuroraStringBuilder* aurora_string_builder_create(void);
+void aurora_string_builder_append(AuroraStringBuilder* sb, AuroraString* str);
+void aurora_string_builder_append_bytes(AuroraStringBuilder* sb, const char* bytes, int64_t length);
+
+// Materialize the accumulated bytes as a string and free the builder
+AuroraString* aurora_string_builder_finish(AuroraStringBuilder* sb);
+
+// Discard a builder without materializing
+void aurora_string_builder_free(AuroraStringBuilder* sb);
+
 // Memory Management
 void* aurora_malloc(size_t size);
 void aurora_free(void* ptr);
 
+// Pooled allocation: small blocks come from size-class slabs with
+// thread-local free lists (magazines); larger requests fall through to
+// malloc. Every pooled block records its own size class, so callers
+// free without passing the size back. Object, array, and string
+// creation allocate through this pool.
+void* aurora_pool_alloc(size_t size);
+void aurora_pool_free(void* ptr);
+
+// Release a batch of objects at once (scope-teardown hook)
+void aurora_release_n(void** objects, int64_t count);
+
 // Reference Counting (ARC)
 // These functions work on any heap-allocated object with AuroraRefCountHeader
 void* aurora_retain(void* ptr);
 void aurora_release(void* ptr);
 int64_t aurora_get_ref_count(void* ptr);
 
+// Mark an object as shared across threads. Must be called on the owning
+// thread before the object escapes; from then on its refcount is updated
+// atomically. Returns ptr for call chaining.
+void* aurora_mark_shared(void* ptr);
+
 // Debugging and Assertions
 void aurora_assert(int condition, const char* message);
 void aurora_panic(const char* message);
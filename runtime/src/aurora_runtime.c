@@ -3,6 +3,116 @@
 #include <string.h>
 #include <stdio.h>
 
+#if !defined(__STDC_NO_ATOMICS__)
+#include <stdatomic.h>
+#define AURORA_HAS_ATOMICS 1
+#else
+#define AURORA_HAS_ATOMICS 0
+#endif
+
+// Compiling with -DAURORA_RC_ATOMIC marks every object shared from
+// birth, for embedders that pass objects between threads freely.
+#ifdef AURORA_RC_ATOMIC
+#define AURORA_RC_INITIAL_FLAGS AURORA_RC_FLAG_SHARED
+#else
+#define AURORA_RC_INITIAL_FLAGS 0u
+#endif
+
+// ============================================================================
+// Size-Class Pool Allocator
+// ============================================================================
+//
+// Small allocations are carved from malloc'd slabs, one free list per
+// size class per thread. Each block is preceded by a 16-byte prefix
+// holding its size class, so aurora_pool_free needs no size argument
+// and blocks may migrate between threads (a block freed on another
+// thread just joins that thread's magazine). Slabs are never returned
+// to the OS; they recycle through the magazines for the process
+// lifetime.
+
+#define AURORA_POOL_CLASS_COUNT 8
+#define AURORA_POOL_CHUNK_OBJECTS 64
+
+static const size_t aurora_pool_class_sizes[AURORA_POOL_CLASS_COUNT] = {
+    16, 32, 48, 64, 96, 128, 192, 256
+};
+
+// 16 bytes so payloads keep max_align_t alignment
+typedef struct {
+    size_t class_index;  // AURORA_POOL_CLASS_COUNT means "straight malloc"
+    size_t reserved;
+} AuroraPoolPrefix;
+
+typedef struct AuroraPoolFreeNode {
+    struct AuroraPoolFreeNode* next;
+} AuroraPoolFreeNode;
+
+static _Thread_local AuroraPoolFreeNode* aurora_pool_magazines[AURORA_POOL_CLASS_COUNT];
+
+static size_t aurora_pool_class_for(size_t size) {
+    for (size_t i = 0; i < AURORA_POOL_CLASS_COUNT; i++) {
+        if (size <= aurora_pool_class_sizes[i]) {
+            return i;
+        }
+    }
+    return AURORA_POOL_CLASS_COUNT;
+}
+
+// Carve a fresh slab into the thread's magazine for one size class
+static void aurora_pool_refill(size_t class_index) {
+    size_t block_size = sizeof(AuroraPoolPrefix) + aurora_pool_class_sizes[class_index];
+    char* slab = (char*)malloc(block_size * AURORA_POOL_CHUNK_OBJECTS);
+    if (!slab) {
+        aurora_panic("Failed to allocate pool slab");
+    }
+    
+    for (int i = 0; i < AURORA_POOL_CHUNK_OBJECTS; i++) {
+        AuroraPoolPrefix* prefix = (AuroraPoolPrefix*)(slab + i * block_size);
+        prefix->class_index = class_index;
+        AuroraPoolFreeNode* node = (AuroraPoolFreeNode*)(prefix + 1);
+        node->next = aurora_pool_magazines[class_index];
+        aurora_pool_magazines[class_index] = node;
+    }
+}
+
+void* aurora_pool_alloc(size_t size) {
+    size_t class_index = aurora_pool_class_for(size);
+    
+    if (class_index >= AURORA_POOL_CLASS_COUNT) {
+        // Too large for the pool
+        AuroraPoolPrefix* prefix = (AuroraPoolPrefix*)malloc(sizeof(AuroraPoolPrefix) + size);
+        if (!prefix) {
+            aurora_panic("Memory allocation failed");
+        }
+        prefix->class_index = AURORA_POOL_CLASS_COUNT;
+        return prefix + 1;
+    }
+    
+    if (!aurora_pool_magazines[class_index]) {
+        aurora_pool_refill(class_index);
+    }
+    
+    AuroraPoolFreeNode* node = aurora_pool_magazines[class_index];
+    aurora_pool_magazines[class_index] = node->next;
+    return node;
+}
+
+void aurora_pool_free(void* ptr) {
+    if (!ptr) return;
+    
+    AuroraPoolPrefix* prefix = (AuroraPoolPrefix*)ptr - 1;
+    size_t class_index = prefix->class_index;
+    
+    if (class_index >= AURORA_POOL_CLASS_COUNT) {
+        free(prefix);
+        return;
+    }
+    
+    AuroraPoolFreeNode* node = (AuroraPoolFreeNode*)ptr;
+    node->next = aurora_pool_magazines[class_index];
+    aurora_pool_magazines[class_index] = node;
+}
+
 // ============================================================================
 // Reference Counting Implementation
 // ============================================================================
@@ -11,74 +121,167 @@ void* aurora_retain(void* ptr) {
     if (!ptr) return NULL;
     
     AuroraRefCountHeader* header = (AuroraRefCountHeader*)ptr;
+    if (header->flags & AURORA_RC_FLAG_IMMORTAL) return ptr;
+#if AURORA_HAS_ATOMICS
+    if (header->flags & AURORA_RC_FLAG_SHARED) {
+        atomic_fetch_add_explicit((_Atomic int64_t*)&header->ref_count, 1,
+                                  memory_order_relaxed);
+        return ptr;
+    }
+#endif
     header->ref_count++;
     return ptr;
 }
 
+static void aurora_release_dealloc(void* ptr, AuroraRefCountHeader* header) {
+    // Call appropriate free function based on type tag
+    switch (header->type) {
+        case AURORA_TYPE_OBJECT:
+            aurora_object_free((AuroraObject*)ptr);
+            break;
+        case AURORA_TYPE_ARRAY:
+            aurora_array_free((AuroraArray*)ptr);
+            break;
+        case AURORA_TYPE_STRING:
+            aurora_string_free((AuroraString*)ptr);
+            break;
+        default:
+            aurora_panic("Unknown object type in aurora_release");
+    }
+}
+
 void aurora_release(void* ptr) {
     if (!ptr) return;
     
     AuroraRefCountHeader* header = (AuroraRefCountHeader*)ptr;
+    if (header->flags & AURORA_RC_FLAG_IMMORTAL) return;
+#if AURORA_HAS_ATOMICS
+    if (header->flags & AURORA_RC_FLAG_SHARED) {
+        if (atomic_fetch_sub_explicit((_Atomic int64_t*)&header->ref_count, 1,
+                                      memory_order_release) == 1) {
+            // Synchronize with the releases on other threads before
+            // tearing the object down
+            atomic_thread_fence(memory_order_acquire);
+            aurora_release_dealloc(ptr, header);
+        }
+        return;
+    }
+#endif
     header->ref_count--;
     
     if (header->ref_count <= 0) {
-        // Call appropriate free function based on type tag
-        switch (header->type) {
-            case AURORA_TYPE_OBJECT:
-                aurora_object_free((AuroraObject*)ptr);
-                break;
-            case AURORA_TYPE_ARRAY:
-                aurora_array_free((AuroraArray*)ptr);
-                break;
-            case AURORA_TYPE_STRING:
-                aurora_string_free((AuroraString*)ptr);
-                break;
-            default:
-                aurora_panic("Unknown object type in aurora_release");
-        }
+        aurora_release_dealloc(ptr, header);
     }
 }
 
 int64_t aurora_get_ref_count(void* ptr) {
     if (!ptr) return 0;
     AuroraRefCountHeader* header = (AuroraRefCountHeader*)ptr;
+#if AURORA_HAS_ATOMICS
+    if (header->flags & AURORA_RC_FLAG_SHARED) {
+        return atomic_load_explicit((_Atomic int64_t*)&header->ref_count,
+                                    memory_order_relaxed);
+    }
+#endif
     return header->ref_count;
 }
 
+void* aurora_mark_shared(void* ptr) {
+    if (!ptr) return NULL;
+    
+    AuroraRefCountHeader* header = (AuroraRefCountHeader*)ptr;
+    if (header->flags & AURORA_RC_FLAG_IMMORTAL) return ptr;
+    // Must run on the owning thread before the object escapes, so a
+    // plain store is sufficient here
+    header->flags |= AURORA_RC_FLAG_SHARED;
+    return ptr;
+}
+
+void aurora_release_n(void** objects, int64_t count) {
+    for (int64_t i = 0; i < count; i++) {
+        aurora_release(objects[i]);
+    }
+}
+
 // ============================================================================
 // Array Implementation
 // ============================================================================
 
 AuroraArray* aurora_array_create(int64_t element_size, int64_t element_count) {
-    AuroraArray* array = (AuroraArray*)malloc(sizeof(AuroraArray));
+    int64_t data_size = element_size * element_count;
+    AuroraArray* array = (AuroraArray*)aurora_pool_alloc(sizeof(AuroraArray) + data_size);
     if (!array) {
         aurora_panic("Failed to allocate array structure");
     }
-    
+
     array->header.ref_count = 1;
     array->header.type = AURORA_TYPE_ARRAY;
+    array->header.flags = AURORA_RC_INITIAL_FLAGS;
     array->length = element_count;
-    array->data = malloc(element_size * element_count);
-    
-    if (!array->data && element_count > 0) {
-        free(array);
-        aurora_panic("Failed to allocate array data");
-    }
-    
+    array->capacity = element_count;
+
     // Initialize to zero
-    if (array->data) {
-        memset(array->data, 0, element_size * element_count);
+    memset(array->data, 0, data_size);
+
+    return array;
+}
+
+// Reallocate to a new capacity, copying the header and live elements.
+// The old block goes back to the pool, so stale aliases into it must
+// not be used after a grow - callers adopt the returned pointer.
+static AuroraArray* aurora_array_realloc(AuroraArray* array, int64_t new_capacity,
+                                         int64_t element_size) {
+    AuroraArray* resized = (AuroraArray*)aurora_pool_alloc(
+        sizeof(AuroraArray) + new_capacity * element_size);
+    if (!resized) {
+        aurora_panic("Failed to grow array");
     }
-    
+    resized->header = array->header;
+    resized->length = array->length;
+    resized->capacity = new_capacity;
+    memcpy(resized->data, array->data, array->length * element_size);
+    aurora_pool_free(array);
+    return resized;
+}
+
+AuroraArray* aurora_array_append(AuroraArray* array, const void* element,
+                                 int64_t element_size) {
+    if (!array) {
+        aurora_panic("Null array in append");
+    }
+    if (array->length == array->capacity) {
+        int64_t new_capacity = array->capacity < 4 ? 8 : array->capacity * 2;
+        array = aurora_array_realloc(array, new_capacity, element_size);
+    }
+    memcpy(array->data + array->length * element_size, element, element_size);
+    array->length++;
     return array;
 }
 
+AuroraArray* aurora_array_reserve(AuroraArray* array, int64_t min_capacity,
+                                  int64_t element_size) {
+    if (!array) {
+        aurora_panic("Null array in reserve");
+    }
+    if (min_capacity <= array->capacity) {
+        return array;
+    }
+    return aurora_array_realloc(array, min_capacity, element_size);
+}
+
+AuroraArray* aurora_array_shrink_to_fit(AuroraArray* array, int64_t element_size) {
+    if (!array) {
+        aurora_panic("Null array in shrink_to_fit");
+    }
+    if (array->capacity == array->length) {
+        return array;
+    }
+    return aurora_array_realloc(array, array->length, element_size);
+}
+
 void aurora_array_free(AuroraArray* array) {
     if (array) {
-        if (array->data) {
-            free(array->data);
-        }
-        free(array);
+        aurora_pool_free(array);
     }
 }
 
@@ -87,7 +290,7 @@ int64_t aurora_array_length(AuroraArray* array) {
 }
 
 void* aurora_array_get_ptr(AuroraArray* array, int64_t index, int64_t element_size) {
-    if (!array || !array->data) {
+    if (!array) {
         aurora_panic("Null array access");
     }
     
@@ -95,7 +298,7 @@ void* aurora_array_get_ptr(AuroraArray* array, int64_t index, int64_t element_si
     aurora_array_bounds_check(array, index);
     #endif
     
-    return (char*)array->data + (index * element_size);
+    return array->data + (index * element_size);
 }
 
 void aurora_array_set(AuroraArray* array, int64_t index, void* element, int64_t element_size) {
@@ -121,21 +324,18 @@ void aurora_array_bounds_check(AuroraArray* array, int64_t index) {
 // ============================================================================
 
 AuroraObject* aurora_object_create(size_t size) {
-    AuroraObject* obj = (AuroraObject*)malloc(sizeof(AuroraObject));
+    AuroraObject* obj = (AuroraObject*)aurora_pool_alloc(sizeof(AuroraObject));
     if (!obj) {
         aurora_panic("Failed to allocate object structure");
     }
     
     obj->header.ref_count = 1;
     obj->header.type = AURORA_TYPE_OBJECT;
+    obj->header.flags = AURORA_RC_INITIAL_FLAGS;
     obj->vtable = NULL;
     obj->size = size;
-    obj->data = malloc(size);
+    obj->data = size > 0 ? aurora_pool_alloc(size) : NULL;
     
-    if (!obj->data && size > 0) {
-        free(obj);
-        aurora_panic("Failed to allocate object data");
-    }
     
     if (obj->data) {
         memset(obj->data, 0, size);
@@ -147,9 +347,9 @@ AuroraObject* aurora_object_create(size_t size) {
 void aurora_object_free(AuroraObject* obj) {
     if (obj) {
         if (obj->data) {
-            free(obj->data);
+            aurora_pool_free(obj->data);
         }
-        free(obj);
+        aurora_pool_free(obj);
     }
 }
 
@@ -157,37 +357,36 @@ void aurora_object_free(AuroraObject* obj) {
 // String Implementation
 // ============================================================================
 
-AuroraString* aurora_string_create(const char* str) {
-    AuroraString* astr = (AuroraString*)malloc(sizeof(AuroraString));
+AuroraString* aurora_string_create_len(const char* bytes, int64_t length) {
+    if (length < 0) {
+        length = 0;
+    }
+
+    AuroraString* astr = (AuroraString*)aurora_pool_alloc(sizeof(AuroraString) + length + 1);
     if (!astr) {
         aurora_panic("Failed to allocate string structure");
     }
-    
+
     astr->header.ref_count = 1;
     astr->header.type = AURORA_TYPE_STRING;
-    astr->length = str ? strlen(str) : 0;
-    astr->data = (char*)malloc(astr->length + 1);
-    
-    if (!astr->data) {
-        free(astr);
-        aurora_panic("Failed to allocate string data");
-    }
-    
-    if (str) {
-        strcpy(astr->data, str);
-    } else {
-        astr->data[0] = '\0';
+    astr->header.flags = AURORA_RC_INITIAL_FLAGS;
+    astr->length = length;
+
+    if (bytes && length > 0) {
+        memcpy(astr->data, bytes, length);
     }
-    
+    astr->data[length] = '\0';
+
     return astr;
 }
 
+AuroraString* aurora_string_create(const char* str) {
+    return aurora_string_create_len(str, str ? (int64_t)strlen(str) : 0);
+}
+
 void aurora_string_free(AuroraString* str) {
     if (str) {
-        if (str->data) {
-            free(str->data);
-        }
-        free(str);
+        aurora_pool_free(str);
     }
 }
 
@@ -195,6 +394,89 @@ int64_t aurora_string_length(AuroraString* str) {
     return str ? str->length : 0;
 }
 
+uint64_t aurora_string_hash(AuroraString* str) {
+    // FNV-1a over the string bytes. The compiler hashes string match
+    // patterns with the same function at compile time, so the constants
+    // here must never change independently (see StmtCodeGen.cpp).
+    uint64_t hash = 14695981039346656037ULL;
+    if (str) {
+        for (int64_t i = 0; i < str->length; i++) {
+            hash ^= (unsigned char)str->data[i];
+            hash *= 1099511628211ULL;
+        }
+    }
+    return hash;
+}
+
+// ============================================================================
+// String Builder Implementation
+// ============================================================================
+
+#define AURORA_SB_INITIAL_CAPACITY 64
+
+AuroraStringBuilder* aurora_string_builder_create(void) {
+    AuroraStringBuilder* sb = (AuroraStringBuilder*)aurora_pool_alloc(sizeof(AuroraStringBuilder));
+    if (!sb) {
+        aurora_panic("Failed to allocate string builder");
+    }
+
+    sb->data = (char*)aurora_pool_alloc(AURORA_SB_INITIAL_CAPACITY);
+    sb->length = 0;
+    sb->capacity = AURORA_SB_INITIAL_CAPACITY;
+
+    return sb;
+}
+
+static void aurora_string_builder_reserve(AuroraStringBuilder* sb, int64_t needed) {
+    if (needed <= sb->capacity) {
+        return;
+    }
+
+    int64_t capacity = sb->capacity;
+    while (capacity < needed) {
+        capacity *= 2;
+    }
+
+    char* data = (char*)aurora_pool_alloc(capacity);
+    memcpy(data, sb->data, sb->length);
+    aurora_pool_free(sb->data);
+    sb->data = data;
+    sb->capacity = capacity;
+}
+
+void aurora_string_builder_append_bytes(AuroraStringBuilder* sb, const char* bytes, int64_t length) {
+    if (!sb || !bytes || length <= 0) {
+        return;
+    }
+
+    aurora_string_builder_reserve(sb, sb->length + length);
+    memcpy(sb->data + sb->length, bytes, length);
+    sb->length += length;
+}
+
+void aurora_string_builder_append(AuroraStringBuilder* sb, AuroraString* str) {
+    if (str) {
+        aurora_string_builder_append_bytes(sb, str->data, str->length);
+    }
+}
+
+AuroraString* aurora_string_builder_finish(AuroraStringBuilder* sb) {
+    if (!sb) {
+        return aurora_string_create_len(NULL, 0);
+    }
+
+    AuroraString* result = aurora_string_create_len(sb->data, sb->length);
+    aurora_string_builder_free(sb);
+    return result;
+}
+
+void aurora_string_builder_free(AuroraStringBuilder* sb) {
+    if (sb) {
+        aurora_pool_free(sb->data);
+        aurora_pool_free(sb);
+    }
+}
+
 // ============================================================================
 // Memory Management
 // ============================================================================
@@ -223,7 +505,16 @@ void aurora_assert(int condition, const char* message) {
     }
 }
 
+// The stdlib's buffered printer flushes through atexit, but atexit
+// handlers do not run on abort(). Declared weak so the runtime keeps
+// working without the stdlib; when it is linked in, the buffer is
+// drained before the panic so output printed earlier is not lost.
+extern void aurora_print_flush(void) __attribute__((weak));
+
 void aurora_panic(const char* message) {
+    if (aurora_print_flush) {
+        aurora_print_flush();
+    }
     fprintf(stderr, "\n[Aurora Runtime Panic] %s\n", message);
     abort();
 }
@@ -3,7 +3,11 @@
 // AuroraLang Standard Library - Native Interface
 // Clean, minimal C API for performance-critical operations
 // Design inspired by Kotlin and Swift standard libraries
+//
+// Strings are the runtime's length-prefixed AuroraString objects; raw
+// char* appears only where the platform demands it (see aurora_runtime.h)
 
+#include "aurora_runtime.h"
 #include <cstdint>
 
 namespace aurorax {
@@ -17,33 +21,35 @@ extern "C" {
     int64_t aurora_print_int(int64_t value);
     double aurora_print_double(double value);
     int aurora_print_bool(int value);
-    void aurora_print_string(const char* str);
-    
+    void aurora_print_string(AuroraString* str);
+
     // Print with newline
     int64_t aurora_println_int(int64_t value);
     double aurora_println_double(double value);
     int aurora_println_bool(int value);
-    void aurora_println_string(const char* str);
+    void aurora_println_string(AuroraString* str);
+
+    // Force the buffered output to the OS (also runs at process exit)
+    void aurora_print_flush();
 }
 
 // ============================================================================
 // String Operations
 // ============================================================================
 
+// aurora_string_length and aurora_string_free come from the runtime,
+// which owns the string representation
 extern "C" {
-    int64_t aurora_string_length(const char* str);
-    char* aurora_string_concat(const char* a, const char* b);
-    int aurora_string_compare(const char* a, const char* b);
-    int aurora_string_equals(const char* a, const char* b);
-    char* aurora_string_substring(const char* str, int64_t start, int64_t end);
-    
+    AuroraString* aurora_string_concat(AuroraString* a, AuroraString* b);
+    int aurora_string_compare(AuroraString* a, AuroraString* b);
+    int aurora_string_equals(AuroraString* a, AuroraString* b);
+    AuroraString* aurora_string_substring(AuroraString* str, int64_t start, int64_t end);
+
     // Conversions
-    int64_t aurora_string_to_int(const char* str);
-    double aurora_string_to_double(const char* str);
-    char* aurora_int_to_string(int64_t value);
-    char* aurora_double_to_string(double value);
-    
-    void aurora_string_free(char* str);
+    int64_t aurora_string_to_int(AuroraString* str);
+    double aurora_string_to_double(AuroraString* str);
+    AuroraString* aurora_int_to_string(int64_t value);
+    AuroraString* aurora_double_to_string(double value);
 }
 
 // ============================================================================
@@ -93,11 +99,11 @@ extern "C" {
 // ============================================================================
 
 extern "C" {
-    char* aurora_file_read(const char* path);
-    int aurora_file_write(const char* path, const char* content);
-    int aurora_file_append(const char* path, const char* content);
-    int aurora_file_exists(const char* path);
-    int aurora_file_delete(const char* path);
+    AuroraString* aurora_file_read(AuroraString* path);
+    int aurora_file_write(AuroraString* path, AuroraString* content);
+    int aurora_file_append(AuroraString* path, AuroraString* content);
+    int aurora_file_exists(AuroraString* path);
+    int aurora_file_delete(AuroraString* path);
 }
 
 // ============================================================================
@@ -106,9 +112,9 @@ extern "C" {
 
 extern "C" {
     void aurora_exit(int code);
-    char* aurora_get_env(const char* name);
+    AuroraString* aurora_get_env(AuroraString* name);
     int64_t aurora_arg_count();
-    char* aurora_arg_get(int64_t index);
+    AuroraString* aurora_arg_get(int64_t index);
 }
 
 } // namespace aurorax
@@ -1,335 +1,493 @@
 #include "aurorax/StdLib.h"
 #include <iostream>
+#include <charconv>
+#include <cstdio>
 #include <cstring>
 #include <cmath>
 #include <cstdlib>
 #include <ctime>
 #include <fstream>
 #include <sstream>
+#include <string_view>
 #include <chrono>
 #include <thread>
 
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
 namespace aurorax {
 
 // ============================================================================
 // Core I/O Functions
 // ============================================================================
+//
+// The print family writes into one process-wide buffer and hits the OS
+// with a single write per flush, instead of a flushed stdio call per
+// print. Flushes happen when the buffer fills, at process exit, on
+// demand via aurora_print_flush, and after every newline when stdout is
+// a terminal so interactive programs still feel live. The buffer size
+// defaults to 64 KiB and can be overridden with AURORA_PRINT_BUFFER.
+
+namespace {
+    // Allocation-free number formatting into caller buffers, shared by
+    // the print family and the to_string conversions. Integers are
+    // emitted two digits at a time from a 00..99 table; doubles go
+    // through std::to_chars (shortest-digit float formatting) pinned to
+    // general/6 so the text matches what iostream's default and %g
+    // produced before. Neither path touches the heap or the locale.
+
+    constexpr char kDigitPairs[201] =
+        "0001020304050607080910111213141516171819"
+        "2021222324252627282930313233343536373839"
+        "4041424344454647484950515253545556575859"
+        "6061626364656667686970717273747576777879"
+        "8081828384858687888990919293949596979899";
+
+    // Formats `value` into `out` (needs at most 20 bytes, no NUL);
+    // returns the length
+    int formatInt(char* out, int64_t value) {
+        uint64_t magnitude = static_cast<uint64_t>(value);
+        char* p = out;
+        if (value < 0) {
+            *p++ = '-';
+            magnitude = 0 - magnitude;  // safe for INT64_MIN
+        }
+
+        char tmp[20];
+        char* t = tmp + sizeof(tmp);
+        while (magnitude >= 100) {
+            const char* pair = kDigitPairs + (magnitude % 100) * 2;
+            *--t = pair[1];
+            *--t = pair[0];
+            magnitude /= 100;
+        }
+        if (magnitude >= 10) {
+            const char* pair = kDigitPairs + magnitude * 2;
+            *--t = pair[1];
+            *--t = pair[0];
+        } else {
+            *--t = static_cast<char>('0' + magnitude);
+        }
+
+        size_t digits = tmp + sizeof(tmp) - t;
+        std::memcpy(p, t, digits);
+        return static_cast<int>(p + digits - out);
+    }
+
+    // Formats `value` into `out` (32 bytes suffice, no NUL); returns the
+    // length
+    int formatDouble(char* out, size_t capacity, double value) {
+        auto result = std::to_chars(out, out + capacity, value,
+                                    std::chars_format::general, 6);
+        if (result.ec != std::errc()) {
+            return std::snprintf(out, capacity, "%g", value);
+        }
+        return static_cast<int>(result.ptr - out);
+    }
+}
+
+namespace {
+    constexpr size_t kDefaultPrintBufferSize = 64 * 1024;
+
+    char* print_buffer = nullptr;
+    size_t print_capacity = 0;
+    size_t print_length = 0;
+    bool print_line_buffered = false;
+
+    void flushPrintBuffer() {
+        if (print_length > 0) {
+            std::fwrite(print_buffer, 1, print_length, stdout);
+            std::fflush(stdout);
+            print_length = 0;
+        }
+    }
+
+    void ensurePrintBuffer() {
+        if (print_buffer) return;
+
+        size_t size = kDefaultPrintBufferSize;
+        if (const char* env = std::getenv("AURORA_PRINT_BUFFER")) {
+            long parsed = std::strtol(env, nullptr, 10);
+            if (parsed > 0) {
+                size = static_cast<size_t>(parsed);
+            }
+        }
+
+        print_buffer = new char[size];
+        print_capacity = size;
+#ifndef _WIN32
+        print_line_buffered = isatty(fileno(stdout)) != 0;
+#else
+        print_line_buffered = true;
+#endif
+        std::atexit(flushPrintBuffer);
+    }
+
+    void writeOutput(const char* bytes, size_t length) {
+        ensurePrintBuffer();
+
+        if (length >= print_capacity) {
+            // Oversized payloads bypass the buffer entirely
+            flushPrintBuffer();
+            std::fwrite(bytes, 1, length, stdout);
+            std::fflush(stdout);
+            return;
+        }
+
+        if (print_length + length > print_capacity) {
+            flushPrintBuffer();
+        }
+        std::memcpy(print_buffer + print_length, bytes, length);
+        print_length += length;
+
+        if (print_line_buffered && std::memchr(bytes, '\n', length)) {
+            flushPrintBuffer();
+        }
+    }
+
+    void writeInt(int64_t value) {
+        char tmp[32];
+        writeOutput(tmp, formatInt(tmp, value));
+    }
+
+    void writeDouble(double value) {
+        char tmp[32];
+        writeOutput(tmp, formatDouble(tmp, sizeof(tmp), value));
+    }
+
+    void writeBool(int value) {
+        if (value) {
+            writeOutput("true", 4);
+        } else {
+            writeOutput("false", 5);
+        }
+    }
+}
 
 extern "C" {
     int64_t aurora_print_int(int64_t value) {
-        std::cout << value;
-        std::cout.flush();
+        writeInt(value);
         return value;
     }
-    
+
     double aurora_print_double(double value) {
-        std::cout << value;
-        std::cout.flush();
+        writeDouble(value);
         return value;
     }
-    
+
     int aurora_print_bool(int value) {
-        std::cout << (value ? "true" : "false");
-        std::cout.flush();
+        writeBool(value);
         return value;
     }
-    
-    void aurora_print_string(const char* str) {
+
+    void aurora_print_string(AuroraString* str) {
         if (str) {
-            std::cout << str;
-            std::cout.flush();
+            writeOutput(str->data, str->length);
         }
     }
-    
+
     int64_t aurora_println_int(int64_t value) {
-        std::cout << value << std::endl;
+        writeInt(value);
+        writeOutput("\n", 1);
         return value;
     }
-    
+
     double aurora_println_double(double value) {
-        std::cout << value << std::endl;
+        writeDouble(value);
+        writeOutput("\n", 1);
         return value;
     }
-    
+
     int aurora_println_bool(int value) {
-        std::cout << (value ? "true" : "false") << std::endl;
+        writeBool(value);
+        writeOutput("\n", 1);
         return value;
     }
-    
-    void aurora_println_string(const char* str) {
+
+    void aurora_println_string(AuroraString* str) {
         if (str) {
-            std::cout << str << std::endl;
+            writeOutput(str->data, str->length);
+            writeOutput("\n", 1);
         }
     }
+
+    void aurora_print_flush() {
+        flushPrintBuffer();
+    }
 }
 
 // ============================================================================
 // String Operations
 // ============================================================================
 
-extern "C" {
-    int64_t aurora_string_length(const char* str) {
-        return str ? static_cast<int64_t>(strlen(str)) : 0;
+// Strings are the runtime's length-prefixed AuroraString objects, so
+// lengths are O(1) fields and the operations below work on memcpy/memcmp
+// over known sizes instead of walking for NUL terminators. The inline
+// bytes stay NUL-terminated, so `data` still crosses FFI boundaries as a
+// plain C string. aurora_string_length and aurora_string_free live in
+// the runtime alongside the representation.
+
+namespace {
+    std::string_view view(const AuroraString* str) {
+        return std::string_view(str->data, static_cast<size_t>(str->length));
     }
-    
-    char* aurora_string_concat(const char* a, const char* b) {
+
+    // Word-parallel string kernels. Equality and comparison already sit
+    // on memcmp, and the searches below lean on memchr - both get
+    // CPU-dispatched vector implementations from libc. Case conversion
+    // has no libc primitive, so it is done eight bytes at a time here:
+    // ASCII words flip the 0x20 case bit for every letter in one XOR,
+    // and any word with non-ASCII bytes drops to the locale-aware
+    // scalar path for those eight bytes.
+
+    constexpr uint64_t kHighBits = 0x8080808080808080ULL;
+    constexpr uint64_t kLowBytes = 0x0101010101010101ULL;
+
+    uint64_t loadWord(const char* p) {
+        uint64_t w;
+        std::memcpy(&w, p, sizeof(w));
+        return w;
+    }
+
+    void storeWord(char* p, uint64_t w) {
+        std::memcpy(p, &w, sizeof(w));
+    }
+
+    // 0x20 at every byte of `word` within [lo, hi], 0 elsewhere.
+    // Valid only when no byte has its high bit set.
+    uint64_t caseBitMask(uint64_t word, char lo, char hi) {
+        uint64_t ge_lo = word + (0x80 - static_cast<uint64_t>(lo)) * kLowBytes;
+        uint64_t gt_hi = word + (0x7F - static_cast<uint64_t>(hi)) * kLowBytes;
+        return ((ge_lo ^ gt_hi) & kHighBits) >> 2;
+    }
+
+    void convertCase(const char* src, char* dst, int64_t length, bool to_upper) {
+        const char lo = to_upper ? 'a' : 'A';
+        const char hi = to_upper ? 'z' : 'Z';
+
+        int64_t i = 0;
+        for (; i + 8 <= length; i += 8) {
+            uint64_t word = loadWord(src + i);
+            if (word & kHighBits) {
+                for (int64_t j = i; j < i + 8; j++) {
+                    unsigned char c = static_cast<unsigned char>(src[j]);
+                    dst[j] = static_cast<char>(to_upper ? std::toupper(c) : std::tolower(c));
+                }
+            } else {
+                storeWord(dst + i, word ^ caseBitMask(word, lo, hi));
+            }
+        }
+        for (; i < length; i++) {
+            unsigned char c = static_cast<unsigned char>(src[i]);
+            dst[i] = static_cast<char>(to_upper ? std::toupper(c) : std::tolower(c));
+        }
+    }
+
+    // First-byte skip via memchr, then a length-bounded memcmp on each
+    // candidate; the lengths are fields, so no pass ever walks past the
+    // needle's true extent
+    int64_t findSubstring(const AuroraString* str, const AuroraString* substr) {
+        if (substr->length == 0) return 0;
+        if (substr->length > str->length) return -1;
+
+        const char first = substr->data[0];
+        const char* p = str->data;
+        const char* last_start = str->data + (str->length - substr->length);
+
+        while (p <= last_start) {
+            p = static_cast<const char*>(
+                std::memchr(p, first, last_start - p + 1));
+            if (!p) return -1;
+            if (std::memcmp(p, substr->data, substr->length) == 0) {
+                return p - str->data;
+            }
+            p++;
+        }
+        return -1;
+    }
+}
+
+extern "C" {
+    AuroraString* aurora_string_concat(AuroraString* a, AuroraString* b) {
         if (!a || !b) return nullptr;
-        
-        size_t len_a = strlen(a);
-        size_t len_b = strlen(b);
-        char* result = new char[len_a + len_b + 1];
-        
-        strcpy(result, a);
-        strcat(result, b);
-        
+
+        AuroraString* result = aurora_string_create_len(nullptr, a->length + b->length);
+        std::memcpy(result->data, a->data, a->length);
+        std::memcpy(result->data + a->length, b->data, b->length);
+
         return result;
     }
-    
-    int aurora_string_compare(const char* a, const char* b) {
+
+    int aurora_string_compare(AuroraString* a, AuroraString* b) {
         if (!a || !b) return 0;
-        return strcmp(a, b);
+
+        int64_t min_len = a->length < b->length ? a->length : b->length;
+        int cmp = std::memcmp(a->data, b->data, min_len);
+        if (cmp != 0) return cmp;
+        return (a->length > b->length) - (a->length < b->length);
     }
-    
-    int aurora_string_equals(const char* a, const char* b) {
+
+    int aurora_string_equals(AuroraString* a, AuroraString* b) {
         if (!a || !b) return 0;
-        return strcmp(a, b) == 0 ? 1 : 0;
+        if (a->length != b->length) return 0;
+        return std::memcmp(a->data, b->data, a->length) == 0 ? 1 : 0;
     }
-    
-    char* aurora_string_substring(const char* str, int64_t start, int64_t end) {
+
+    AuroraString* aurora_string_substring(AuroraString* str, int64_t start, int64_t end) {
         if (!str) return nullptr;
-        
-        int64_t len = static_cast<int64_t>(strlen(str));
-        if (start < 0 || end > len || start >= end) return nullptr;
-        
-        int64_t sub_len = end - start;
-        char* result = new char[sub_len + 1];
-        strncpy(result, str + start, sub_len);
-        result[sub_len] = '\0';
-        
-        return result;
+        if (start < 0 || end > str->length || start >= end) return nullptr;
+
+        return aurora_string_create_len(str->data + start, end - start);
     }
-    
-    char aurora_string_char_at(const char* str, int64_t index) {
+
+    char aurora_string_char_at(AuroraString* str, int64_t index) {
         if (!str) return '\0';
-        int64_t len = static_cast<int64_t>(strlen(str));
-        if (index < 0 || index >= len) return '\0';
-        return str[index];
+        if (index < 0 || index >= str->length) return '\0';
+        return str->data[index];
     }
-    
-    char* aurora_string_trim(const char* str) {
+
+    AuroraString* aurora_string_trim(AuroraString* str) {
         if (!str) return nullptr;
-        
-        const char* start = str;
-        while (*start && std::isspace(static_cast<unsigned char>(*start))) {
+
+        int64_t start = 0;
+        int64_t end = str->length;
+        while (start < end && std::isspace(static_cast<unsigned char>(str->data[start]))) {
             start++;
         }
-        
-        if (*start == '\0') {
-            char* result = new char[1];
-            result[0] = '\0';
-            return result;
-        }
-        
-        const char* end = str + strlen(str) - 1;
-        while (end > start && std::isspace(static_cast<unsigned char>(*end))) {
+        while (end > start && std::isspace(static_cast<unsigned char>(str->data[end - 1]))) {
             end--;
         }
-        
-        size_t len = end - start + 1;
-        char* result = new char[len + 1];
-        strncpy(result, start, len);
-        result[len] = '\0';
-        
-        return result;
+
+        return aurora_string_create_len(str->data + start, end - start);
     }
-    
-    char* aurora_string_trim_start(const char* str) {
+
+    AuroraString* aurora_string_trim_start(AuroraString* str) {
         if (!str) return nullptr;
-        
-        const char* start = str;
-        while (*start && std::isspace(static_cast<unsigned char>(*start))) {
+
+        int64_t start = 0;
+        while (start < str->length && std::isspace(static_cast<unsigned char>(str->data[start]))) {
             start++;
         }
-        
-        size_t len = strlen(start);
-        char* result = new char[len + 1];
-        strcpy(result, start);
-        
-        return result;
+
+        return aurora_string_create_len(str->data + start, str->length - start);
     }
-    
-    char* aurora_string_trim_end(const char* str) {
+
+    AuroraString* aurora_string_trim_end(AuroraString* str) {
         if (!str) return nullptr;
-        
-        size_t len = strlen(str);
-        if (len == 0) {
-            char* result = new char[1];
-            result[0] = '\0';
-            return result;
-        }
-        
-        const char* end = str + len - 1;
-        while (end >= str && std::isspace(static_cast<unsigned char>(*end))) {
+
+        int64_t end = str->length;
+        while (end > 0 && std::isspace(static_cast<unsigned char>(str->data[end - 1]))) {
             end--;
         }
-        
-        len = end - str + 1;
-        char* result = new char[len + 1];
-        strncpy(result, str, len);
-        result[len] = '\0';
-        
-        return result;
+
+        return aurora_string_create_len(str->data, end);
     }
-    
-    int aurora_string_starts_with(const char* str, const char* prefix) {
+
+    int aurora_string_starts_with(AuroraString* str, AuroraString* prefix) {
         if (!str || !prefix) return 0;
-        size_t str_len = strlen(str);
-        size_t prefix_len = strlen(prefix);
-        if (prefix_len > str_len) return 0;
-        return strncmp(str, prefix, prefix_len) == 0 ? 1 : 0;
+        if (prefix->length > str->length) return 0;
+        return std::memcmp(str->data, prefix->data, prefix->length) == 0 ? 1 : 0;
     }
-    
-    int aurora_string_ends_with(const char* str, const char* suffix) {
+
+    int aurora_string_ends_with(AuroraString* str, AuroraString* suffix) {
         if (!str || !suffix) return 0;
-        size_t str_len = strlen(str);
-        size_t suffix_len = strlen(suffix);
-        if (suffix_len > str_len) return 0;
-        return strcmp(str + str_len - suffix_len, suffix) == 0 ? 1 : 0;
+        if (suffix->length > str->length) return 0;
+        return std::memcmp(str->data + str->length - suffix->length,
+                           suffix->data, suffix->length) == 0 ? 1 : 0;
     }
-    
-    int aurora_string_contains(const char* str, const char* substr) {
+
+    int aurora_string_contains(AuroraString* str, AuroraString* substr) {
         if (!str || !substr) return 0;
-        return strstr(str, substr) != nullptr ? 1 : 0;
+        return findSubstring(str, substr) >= 0 ? 1 : 0;
     }
-    
-    int64_t aurora_string_index_of(const char* str, const char* substr) {
+
+    int64_t aurora_string_index_of(AuroraString* str, AuroraString* substr) {
         if (!str || !substr) return -1;
-        const char* found = strstr(str, substr);
-        if (!found) return -1;
-        return static_cast<int64_t>(found - str);
+        return findSubstring(str, substr);
     }
-    
-    int64_t aurora_string_last_index_of(const char* str, const char* substr) {
+
+    int64_t aurora_string_last_index_of(AuroraString* str, AuroraString* substr) {
         if (!str || !substr) return -1;
-        
-        const char* last_found = nullptr;
-        const char* current = str;
-        
-        while ((current = strstr(current, substr)) != nullptr) {
-            last_found = current;
-            current++;
-        }
-        
-        if (!last_found) return -1;
-        return static_cast<int64_t>(last_found - str);
+        size_t pos = view(str).rfind(view(substr));
+        return pos != std::string_view::npos ? static_cast<int64_t>(pos) : -1;
     }
-    
-    char* aurora_string_to_upper(const char* str) {
+
+    AuroraString* aurora_string_to_upper(AuroraString* str) {
         if (!str) return nullptr;
-        
-        size_t len = strlen(str);
-        char* result = new char[len + 1];
-        
-        for (size_t i = 0; i < len; i++) {
-            result[i] = static_cast<char>(std::toupper(static_cast<unsigned char>(str[i])));
-        }
-        result[len] = '\0';
-        
+
+        AuroraString* result = aurora_string_create_len(nullptr, str->length);
+        convertCase(str->data, result->data, str->length, true);
         return result;
     }
-    
-    char* aurora_string_to_lower(const char* str) {
+
+    AuroraString* aurora_string_to_lower(AuroraString* str) {
         if (!str) return nullptr;
-        
-        size_t len = strlen(str);
-        char* result = new char[len + 1];
-        
-        for (size_t i = 0; i < len; i++) {
-            result[i] = static_cast<char>(std::tolower(static_cast<unsigned char>(str[i])));
-        }
-        result[len] = '\0';
-        
+
+        AuroraString* result = aurora_string_create_len(nullptr, str->length);
+        convertCase(str->data, result->data, str->length, false);
         return result;
     }
-    
-    char* aurora_string_replace(const char* str, const char* from, const char* to) {
+
+    AuroraString* aurora_string_replace(AuroraString* str, AuroraString* from, AuroraString* to) {
         if (!str || !from || !to) return nullptr;
-        
-        std::string s = str;
-        size_t from_len = strlen(from);
-        size_t to_len = strlen(to);
+
+        std::string s(str->data, str->length);
         size_t pos = 0;
-        
-        while ((pos = s.find(from, pos)) != std::string::npos) {
-            s.replace(pos, from_len, to);
-            pos += to_len;
+
+        while ((pos = s.find(from->data, pos, from->length)) != std::string::npos) {
+            s.replace(pos, from->length, to->data, to->length);
+            pos += to->length;
         }
-        
-        char* result = new char[s.length() + 1];
-        strcpy(result, s.c_str());
-        return result;
+
+        return aurora_string_create_len(s.data(), static_cast<int64_t>(s.length()));
     }
-    
-    char* aurora_string_repeat(const char* str, int64_t count) {
+
+    AuroraString* aurora_string_repeat(AuroraString* str, int64_t count) {
         if (!str || count <= 0) {
-            char* result = new char[1];
-            result[0] = '\0';
-            return result;
+            return aurora_string_create_len(nullptr, 0);
         }
-        
-        size_t len = strlen(str);
-        size_t total_len = len * count;
-        char* result = new char[total_len + 1];
-        
+
+        AuroraString* result = aurora_string_create_len(nullptr, str->length * count);
         for (int64_t i = 0; i < count; i++) {
-            strcpy(result + (i * len), str);
+            std::memcpy(result->data + i * str->length, str->data, str->length);
         }
-        result[total_len] = '\0';
-        
+
         return result;
     }
-    
-    int64_t aurora_string_to_int(const char* str) {
+
+    int64_t aurora_string_to_int(AuroraString* str) {
         if (!str) return 0;
         try {
-            return static_cast<int64_t>(std::stoll(str));
+            return static_cast<int64_t>(std::stoll(str->data));
         } catch (...) {
             return 0;
         }
     }
-    
-    double aurora_string_to_double(const char* str) {
+
+    double aurora_string_to_double(AuroraString* str) {
         if (!str) return 0.0;
         try {
-            return std::stod(str);
+            return std::stod(str->data);
         } catch (...) {
             return 0.0;
         }
     }
-    
-    char* aurora_int_to_string(int64_t value) {
-        std::string str = std::to_string(value);
-        char* result = new char[str.length() + 1];
-        strcpy(result, str.c_str());
-        return result;
-    }
-    
-    char* aurora_double_to_string(double value) {
-        std::string str = std::to_string(value);
-        char* result = new char[str.length() + 1];
-        strcpy(result, str.c_str());
-        return result;
+
+    AuroraString* aurora_int_to_string(int64_t value) {
+        char tmp[32];
+        return aurora_string_create_len(tmp, formatInt(tmp, value));
     }
-    
-    char* aurora_bool_to_string(int value) {
-        const char* str = value ? "true" : "false";
-        char* result = new char[strlen(str) + 1];
-        strcpy(result, str);
-        return result;
+
+    AuroraString* aurora_double_to_string(double value) {
+        // std::to_string's %f formatting padded every value to six
+        // decimals ("1.000000"); this matches the print family instead
+        char tmp[32];
+        return aurora_string_create_len(tmp, formatDouble(tmp, sizeof(tmp), value));
     }
-    
-    void aurora_string_free(char* str) {
-        delete[] str;
+
+    AuroraString* aurora_bool_to_string(int value) {
+        return aurora_string_create(value ? "true" : "false");
     }
 }
 
@@ -407,51 +565,49 @@ extern "C" {
 // ============================================================================
 
 extern "C" {
-    char* aurora_file_read(const char* path) {
+    AuroraString* aurora_file_read(AuroraString* path) {
         if (!path) return nullptr;
-        
-        std::ifstream file(path);
+
+        std::ifstream file(path->data);
         if (!file.is_open()) return nullptr;
-        
+
         std::stringstream buffer;
         buffer << file.rdbuf();
         std::string content = buffer.str();
-        
-        char* result = new char[content.length() + 1];
-        strcpy(result, content.c_str());
-        
-        return result;
+
+        return aurora_string_create_len(content.data(),
+                                        static_cast<int64_t>(content.length()));
     }
-    
-    int aurora_file_write(const char* path, const char* content) {
+
+    int aurora_file_write(AuroraString* path, AuroraString* content) {
         if (!path || !content) return -1;
-        
-        std::ofstream file(path);
+
+        std::ofstream file(path->data);
         if (!file.is_open()) return -1;
-        
-        file << content;
+
+        file.write(content->data, content->length);
         return 0;
     }
-    
-    int aurora_file_append(const char* path, const char* content) {
+
+    int aurora_file_append(AuroraString* path, AuroraString* content) {
         if (!path || !content) return -1;
-        
-        std::ofstream file(path, std::ios::app);
+
+        std::ofstream file(path->data, std::ios::app);
         if (!file.is_open()) return -1;
-        
-        file << content;
+
+        file.write(content->data, content->length);
         return 0;
     }
-    
-    int aurora_file_exists(const char* path) {
+
+    int aurora_file_exists(AuroraString* path) {
         if (!path) return 0;
-        std::ifstream file(path);
+        std::ifstream file(path->data);
         return file.good() ? 1 : 0;
     }
-    
-    int aurora_file_delete(const char* path) {
+
+    int aurora_file_delete(AuroraString* path) {
         if (!path) return -1;
-        return std::remove(path);
+        return std::remove(path->data);
     }
 }
 
@@ -464,14 +620,12 @@ extern "C" {
         std::exit(code);
     }
     
-    char* aurora_get_env(const char* name) {
+    AuroraString* aurora_get_env(AuroraString* name) {
         if (!name) return nullptr;
-        const char* value = std::getenv(name);
+        const char* value = std::getenv(name->data);
         if (!value) return nullptr;
-        
-        char* result = new char[strlen(value) + 1];
-        strcpy(result, value);
-        return result;
+
+        return aurora_string_create(value);
     }
     
     // These will be set by the main program
@@ -482,13 +636,10 @@ extern "C" {
         return g_argc;
     }
     
-    char* aurora_arg_get(int64_t index) {
+    AuroraString* aurora_arg_get(int64_t index) {
         if (index < 0 || index >= g_argc || !g_argv) return nullptr;
-        
-        const char* arg = g_argv[index];
-        char* result = new char[strlen(arg) + 1];
-        strcpy(result, arg);
-        return result;
+
+        return aurora_string_create(g_argv[index]);
     }
 }
 
@@ -0,0 +1,249 @@
+#include "aurora/Type.h"
+#include "aurora/Lexer.h"
+#include "aurora/Parser.h"
+#include "aurora/CodeGen.h"
+#include "aurora/AST.h"
+#include "aurora/Diagnostic.h"
+#include "aurora/Logger.h"
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+using namespace aurora;
+
+// AuroraLang benchmark suite.
+//
+// Measures the pipeline stages the CI wall clock hides: lexer throughput,
+// parse time, codegen time, JIT warm-up, and the steady-state runtime of the
+// compiled program. Iteration counts are fixed (not adaptive) and every line
+// of the report has a stable label and unit, so two runs can be diffed
+// directly across commits.
+
+// External function callable from Aurora code (same hook the CLI provides)
+extern "C" double printd(double x) {
+    std::cout << x << std::endl;
+    return 0;
+}
+
+using Clock = std::chrono::steady_clock;
+
+static double elapsedMillis(Clock::time_point start, Clock::time_point end) {
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// Built-in workload: integer arithmetic, function calls, and array traffic
+// with no I/O, so timings measure compute rather than the terminal
+static const char* kBuiltinWorkload = R"aurora(
+fn mix(a: int, b: int) -> int {
+    return (a * 31 + b) - (a / 3)
+}
+
+fn work(n: int) -> int {
+    var acc: int = 0
+    var i: int = 0
+    while i < n {
+        acc = mix(acc, i) + mix(i, acc)
+        i = i + 1
+    }
+    return acc
+}
+
+fn sumArray() -> int {
+    let values = [3, 1, 4, 1, 5, 9, 2, 6, 5, 3]
+    var total: int = 0
+    for i in 0..10 {
+        total = total + values[i]
+    }
+    return total
+}
+
+fn main() -> int {
+    var result: int = 0
+    for round in 0..50 {
+        result = result + work(2000) + sumArray()
+    }
+    return result - result
+}
+)aurora";
+
+static void printUsage(const char* prog) {
+    std::cerr << "Aurora benchmark suite\n\n";
+    std::cerr << "Usage: " << prog << " [options] [file.aur]\n\n";
+    std::cerr << "Runs the compiler pipeline over the given workload (or a built-in\n";
+    std::cerr << "one) and reports per-stage timings in a diff-stable format.\n\n";
+    std::cerr << "Options:\n";
+    std::cerr << "  -h, --help       Show this help message\n";
+    std::cerr << "  --iters <n>      Lex/parse iterations (default: 20)\n";
+    std::cerr << "  --runs <n>       Steady-state runs of main (default: 100)\n";
+    std::cerr << std::flush;
+}
+
+int main(int argc, char** argv) {
+    std::string filename;
+    int iters = 20;
+    int runs = 100;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-h" || arg == "--help") {
+            printUsage(argv[0]);
+            return 0;
+        } else if (arg == "--iters" && i + 1 < argc) {
+            iters = std::atoi(argv[++i]);
+        } else if (arg == "--runs" && i + 1 < argc) {
+            runs = std::atoi(argv[++i]);
+        } else if (!arg.empty() && arg[0] == '-') {
+            std::cerr << "Unknown option: " << arg << "\n";
+            printUsage(argv[0]);
+            return 1;
+        } else {
+            filename = arg;
+        }
+    }
+    if (iters < 1) iters = 1;
+    if (runs < 1) runs = 1;
+
+    std::string source;
+    std::string workload_name;
+    if (filename.empty()) {
+        source = kBuiltinWorkload;
+        workload_name = "<built-in>";
+    } else {
+        std::ifstream file(filename);
+        if (!file) {
+            std::cerr << "Could not open file: " << filename << "\n";
+            return 1;
+        }
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        source = buffer.str();
+        workload_name = filename;
+    }
+
+    // Keep the compiler's own logging out of the report
+    Logger::instance().setLevel(LogLevel::Off);
+    auto& diag = getDiagnosticEngine();
+    diag.setSourceCode(source);
+    diag.setFilename(workload_name);
+
+    std::printf("=== Aurora Benchmark Suite ===\n");
+    std::printf("workload      %s (%zu bytes)\n", workload_name.c_str(), source.size());
+
+    // Accumulate observable results so the compiler cannot discard the
+    // benchmarked work
+    long long sink = 0;
+
+    try {
+        // Lexer throughput: replicate short workloads into a ~1 MB corpus so
+        // the MB/s figure is stable
+        std::string corpus;
+        while (corpus.size() < (1 << 20)) {
+            corpus += source;
+        }
+        double lex_total_ms = 0.0;
+        for (int i = 0; i < iters; i++) {
+            auto start = Clock::now();
+            Lexer lexer(corpus);
+            Token token = lexer.nextToken();
+            while (token.type != TokenType::Eof) {
+                sink += static_cast<int>(token.type);
+                token = lexer.nextToken();
+            }
+            lex_total_ms += elapsedMillis(start, Clock::now());
+        }
+        double lex_mb = static_cast<double>(corpus.size()) * iters / (1024.0 * 1024.0);
+        std::printf("lexer         %10.2f MB/s      (%d iters over %zu KB)\n",
+                    lex_mb / (lex_total_ms / 1000.0), iters, corpus.size() / 1024);
+
+        // Parse time: each iteration gets its own arena so the cost of node
+        // allocation is included and nothing accumulates between runs
+        double parse_total_ms = 0.0;
+        for (int i = 0; i < iters; i++) {
+            ASTArena arena;
+            ASTArenaScope scope(arena);
+            auto start = Clock::now();
+            Lexer lexer(source);
+            Parser parser(lexer);
+            auto functions = parser.parseProgram();
+            parse_total_ms += elapsedMillis(start, Clock::now());
+            sink += static_cast<long long>(functions.size());
+        }
+        std::printf("parse         %10.3f ms/iter   (mean of %d iters)\n",
+                    parse_total_ms / iters, iters);
+
+        // Codegen, JIT warm-up, and steady state share one compilation; the
+        // arena must outlive the JIT'd module
+        ASTArena arena;
+        ASTArenaScope scope(arena);
+        Lexer lexer(source);
+        Parser parser(lexer);
+        auto functions = parser.parseProgram();
+        auto& classes = parser.getClasses();
+        auto& imports = parser.getImports();
+
+        for (auto& import : imports) {
+            if (!import->load(filename)) {
+                std::cerr << "Failed to load module: " << import->getModulePath() << "\n";
+                return 1;
+            }
+        }
+
+        auto& ctx = getGlobalContext();
+        auto codegen_start = Clock::now();
+        for (auto& classDecl : classes) {
+            if (!classDecl->codegen()) {
+                std::cerr << "Codegen failed for class: " << classDecl->getName() << "\n";
+                return 1;
+            }
+        }
+        for (auto& classDecl : classes) {
+            classDecl->codegenMethods();
+        }
+        for (auto& func : functions) {
+            if (!func->codegen()) {
+                std::cerr << "Codegen failed for function: "
+                          << func->getProto()->getName() << "\n";
+                return 1;
+            }
+        }
+        double codegen_ms = elapsedMillis(codegen_start, Clock::now());
+        std::printf("codegen       %10.3f ms\n", codegen_ms);
+
+        if (diag.hasErrors()) {
+            std::cerr << "Compilation produced errors; aborting benchmark\n";
+            return 1;
+        }
+
+        // Warm-up covers JIT construction, symbol resolution, and the first
+        // execution of main (i.e. the cost the first request pays)
+        auto warmup_start = Clock::now();
+        ctx.initializeJIT();
+        int first_result = ctx.runMain();
+        double warmup_ms = elapsedMillis(warmup_start, Clock::now());
+        std::printf("jit-warmup    %10.3f ms        (initialize + first run)\n", warmup_ms);
+
+        // Steady state: repeated runs of the already-compiled main
+        double steady_total_ms = 0.0;
+        for (int i = 0; i < runs; i++) {
+            auto start = Clock::now();
+            sink += ctx.runMain();
+            steady_total_ms += elapsedMillis(start, Clock::now());
+        }
+        std::printf("steady        %10.4f ms/run    (mean of %d runs)\n",
+                    steady_total_ms / runs, runs);
+        std::printf("main-result   %d\n", first_result);
+    } catch (const std::exception& e) {
+        std::cerr << "Benchmark failed: " << e.what() << "\n";
+        return 1;
+    }
+
+    // Referencing the sink keeps the measured loops observable; the value
+    // itself is meaningless
+    if (sink == 0x7fffffffffffffffLL) {
+        std::printf("sink          %lld\n", sink);
+    }
+    return 0;
+}
@@ -0,0 +1,356 @@
+#include "daemon.h"
+#include "aurora/AST.h"
+#include "aurora/CodeGen.h"
+#include "aurora/Diagnostic.h"
+#include "aurora/Logger.h"
+#include "aurora/SourceBuffer.h"
+#include <cerrno>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <llvm/Support/TargetSelect.h>
+
+#ifndef _WIN32
+#include <filesystem>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+namespace aurora {
+
+// Bump when the request protocol changes; mismatched clients are refused
+static constexpr const char* kDaemonProtocolVersion = "1";
+
+// Marker the server appends after a job's output so the client can
+// recover the exit code in-band; the leading control byte keeps it from
+// colliding with normal program output
+static constexpr const char* kExitMarker = "\x01AURORA-EXIT ";
+
+std::string daemonSocketPath() {
+    const char* env_dir = std::getenv("AURORA_CACHE_DIR");
+    if (env_dir && env_dir[0] != '\0') {
+        return std::string(env_dir) + "/daemon.sock";
+    }
+    const char* home = std::getenv("HOME");
+    if (home && home[0] != '\0') {
+        return std::string(home) + "/.cache/aurora/daemon.sock";
+    }
+    return "";
+}
+
+// ============================================================================
+// Job Execution
+// ============================================================================
+
+// Mirrors the option handling in main(); jobs accept the same compile
+// flags a standalone invocation does. Shared with watch mode.
+int runCompileJob(const std::vector<std::string>& args) {
+    std::string filename;
+    std::string output_file;
+    bool emit_llvm = false;
+    bool emit_obj = false;
+    bool emit_exe = false;
+
+    for (size_t i = 0; i < args.size(); i++) {
+        const std::string& arg = args[i];
+        if (arg == "--debug") {
+            Logger::instance().setLevel(LogLevel::Debug);
+            getDiagnosticEngine().setDebugMode(true);
+        } else if (arg == "--trace") {
+            Logger::instance().setLevel(LogLevel::Trace);
+            getDiagnosticEngine().setDebugMode(true);
+        } else if (arg == "--log-level" && i + 1 < args.size()) {
+            const std::string& level = args[++i];
+            if (level == "trace") Logger::instance().setLevel(LogLevel::Trace);
+            else if (level == "debug") Logger::instance().setLevel(LogLevel::Debug);
+            else if (level == "info") Logger::instance().setLevel(LogLevel::Info);
+            else if (level == "warn" || level == "warning") Logger::instance().setLevel(LogLevel::Warning);
+            else if (level == "error") Logger::instance().setLevel(LogLevel::Error);
+            else if (level == "off") Logger::instance().setLevel(LogLevel::Off);
+        } else if (arg == "-O0" || arg == "-O1" || arg == "-O2" || arg == "-O3") {
+            getGlobalContext().setOptimizationLevel(arg[2] - '0');
+        } else if (arg == "--lazy-jit") {
+            getGlobalContext().setLazyJIT(true);
+        } else if (arg == "--pgo") {
+            getGlobalContext().setProfileGuidedJIT(true);
+        } else if ((arg == "-mcpu" || arg == "--mcpu") && i + 1 < args.size()) {
+            getGlobalContext().setTargetCPU(args[++i]);
+        } else if (arg == "--emit-llvm") {
+            emit_llvm = true;
+        } else if (arg == "-c" || arg == "--emit-obj") {
+            emit_obj = true;
+        } else if (arg == "--compile") {
+            emit_exe = true;
+        } else if (arg == "--no-jit-cache") {
+            getGlobalContext().setJITCacheEnabled(false);
+        } else if (arg == "--no-arc-opt") {
+            getGlobalContext().setARCOptEnabled(false);
+        } else if (arg == "-o" && i + 1 < args.size()) {
+            output_file = args[++i];
+        } else if (!arg.empty() && arg[0] != '-') {
+            filename = arg;
+        } else {
+            std::cerr << "aurora daemon: unsupported job option: " << arg << "\n";
+            return 1;
+        }
+    }
+
+    if (filename.empty()) {
+        std::cerr << "aurora daemon: no input file in job\n";
+        return 1;
+    }
+
+    auto source_buffer = SourceBuffer::open(filename);
+    if (!source_buffer) {
+        std::cerr << "aurora daemon: cannot open file: " << filename << "\n";
+        return 1;
+    }
+
+    return compileAndRun(source_buffer->contents(), filename, emit_llvm,
+                         output_file, emit_obj, emit_exe);
+}
+
+#ifndef _WIN32
+
+// ============================================================================
+// Socket Helpers
+// ============================================================================
+
+static bool writeAll(int fd, const char* data, size_t size) {
+    while (size > 0) {
+        ssize_t written = ::write(fd, data, size);
+        if (written <= 0) return false;
+        data += written;
+        size -= static_cast<size_t>(written);
+    }
+    return true;
+}
+
+static bool writeLine(int fd, const std::string& line) {
+    std::string framed = line + "\n";
+    return writeAll(fd, framed.data(), framed.size());
+}
+
+// Read a single newline-terminated line byte-by-byte; request headers are
+// tiny, so simplicity beats buffering here
+static bool readLine(int fd, std::string& line) {
+    line.clear();
+    char c;
+    while (true) {
+        ssize_t n = ::read(fd, &c, 1);
+        if (n <= 0) return !line.empty();
+        if (c == '\n') return true;
+        line.push_back(c);
+    }
+}
+
+// ============================================================================
+// Server
+// ============================================================================
+
+int runDaemonServer() {
+    auto& logger = Logger::instance();
+
+    std::string socket_path = daemonSocketPath();
+    if (socket_path.empty()) {
+        std::cerr << "Error: no cache directory for the daemon socket "
+                  << "(set AURORA_CACHE_DIR or HOME)\n";
+        return 1;
+    }
+    std::error_code ec;
+    std::filesystem::create_directories(
+        std::filesystem::path(socket_path).parent_path(), ec);
+    ::unlink(socket_path.c_str());
+
+    // Warm state every job inherits through fork: LLVM native-target
+    // registration and the sysroot/stdlib search-path scan
+    llvm::InitializeNativeTarget();
+    llvm::InitializeNativeTargetAsmPrinter();
+    llvm::InitializeNativeTargetAsmParser();
+    initializeModuleSystem();
+
+    int server_fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (server_fd < 0) {
+        std::cerr << "Error: cannot create daemon socket: " << std::strerror(errno) << "\n";
+        return 1;
+    }
+
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    if (socket_path.size() >= sizeof(addr.sun_path)) {
+        std::cerr << "Error: daemon socket path too long: " << socket_path << "\n";
+        ::close(server_fd);
+        return 1;
+    }
+    std::strncpy(addr.sun_path, socket_path.c_str(), sizeof(addr.sun_path) - 1);
+
+    if (::bind(server_fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0 ||
+        ::listen(server_fd, 4) < 0) {
+        std::cerr << "Error: cannot bind daemon socket " << socket_path << ": "
+                  << std::strerror(errno) << "\n";
+        ::close(server_fd);
+        return 1;
+    }
+
+    // Dead children from jobs the client abandoned mid-stream
+    ::signal(SIGPIPE, SIG_IGN);
+
+    std::cout << "aurora daemon listening on " << socket_path << "\n";
+    logger.info("Compile daemon started");
+
+    bool running = true;
+    while (running) {
+        int conn = ::accept(server_fd, nullptr, nullptr);
+        if (conn < 0) {
+            if (errno == EINTR) continue;
+            break;
+        }
+
+        // Parse the request header
+        std::string line;
+        std::string cwd;
+        std::vector<std::string> args;
+        bool run_job = false;
+        if (readLine(conn, line) &&
+            line == std::string("AURORA-DAEMON ") + kDaemonProtocolVersion) {
+            while (readLine(conn, line)) {
+                if (line == "RUN") { run_job = true; break; }
+                if (line == "STOP") { running = false; break; }
+                if (line.rfind("CWD ", 0) == 0) cwd = line.substr(4);
+                else if (line.rfind("ARG ", 0) == 0) args.push_back(line.substr(4));
+            }
+        } else {
+            writeLine(conn, "aurora daemon: protocol mismatch, restart the daemon");
+        }
+
+        if (run_job) {
+            pid_t pid = ::fork();
+            if (pid == 0) {
+                // Job child: output goes straight to the client, and the
+                // inherited warm state is private copy-on-write, so the
+                // global compiler context starts fresh for this job
+                ::dup2(conn, STDOUT_FILENO);
+                ::dup2(conn, STDERR_FILENO);
+                ::close(conn);
+                ::close(server_fd);
+                if (!cwd.empty() && ::chdir(cwd.c_str()) != 0) {
+                    std::cerr << "aurora daemon: cannot chdir to " << cwd << "\n";
+                    std::exit(1);
+                }
+                std::exit(runCompileJob(args));
+            }
+
+            int exit_code = 1;
+            if (pid > 0) {
+                int status = 0;
+                ::waitpid(pid, &status, 0);
+                exit_code = WIFEXITED(status) ? WEXITSTATUS(status) : 1;
+            } else {
+                writeLine(conn, "aurora daemon: fork failed");
+            }
+            writeLine(conn, std::string(kExitMarker) + std::to_string(exit_code));
+        }
+
+        ::close(conn);
+    }
+
+    ::close(server_fd);
+    ::unlink(socket_path.c_str());
+    logger.info("Compile daemon stopped");
+    return 0;
+}
+
+// ============================================================================
+// Client
+// ============================================================================
+
+static int connectToDaemon() {
+    std::string socket_path = daemonSocketPath();
+    if (socket_path.empty()) {
+        std::cerr << "Error: no cache directory for the daemon socket\n";
+        return -1;
+    }
+
+    int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) return -1;
+
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    std::strncpy(addr.sun_path, socket_path.c_str(), sizeof(addr.sun_path) - 1);
+    if (::connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) {
+        std::cerr << "Error: no aurora daemon at " << socket_path
+                  << " (start one with: aurora --daemon)\n";
+        ::close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+int runDaemonClient(const std::vector<std::string>& args) {
+    int fd = connectToDaemon();
+    if (fd < 0) return 1;
+
+    writeLine(fd, std::string("AURORA-DAEMON ") + kDaemonProtocolVersion);
+    char cwd_buf[4096];
+    if (::getcwd(cwd_buf, sizeof(cwd_buf))) {
+        writeLine(fd, std::string("CWD ") + cwd_buf);
+    }
+    for (const auto& arg : args) {
+        writeLine(fd, "ARG " + arg);
+    }
+    writeLine(fd, "RUN");
+
+    // Stream everything back; the job's output ends with the exit marker
+    std::string received;
+    char buf[4096];
+    ssize_t n;
+    while ((n = ::read(fd, buf, sizeof(buf))) > 0) {
+        received.append(buf, static_cast<size_t>(n));
+    }
+    ::close(fd);
+
+    int exit_code = 1;
+    size_t marker = received.rfind(kExitMarker);
+    if (marker != std::string::npos) {
+        exit_code = std::atoi(received.c_str() + marker + std::strlen(kExitMarker));
+        received.erase(marker);
+    } else {
+        std::cerr << "Error: daemon connection ended without an exit code\n";
+    }
+    std::cout << received << std::flush;
+    return exit_code;
+}
+
+int stopDaemon() {
+    int fd = connectToDaemon();
+    if (fd < 0) return 1;
+    writeLine(fd, std::string("AURORA-DAEMON ") + kDaemonProtocolVersion);
+    writeLine(fd, "STOP");
+    ::close(fd);
+    std::cout << "aurora daemon stopped\n";
+    return 0;
+}
+
+#else // _WIN32
+
+int runDaemonServer() {
+    std::cerr << "Error: daemon mode requires a POSIX platform\n";
+    return 1;
+}
+
+int runDaemonClient(const std::vector<std::string>&) {
+    std::cerr << "Error: daemon mode requires a POSIX platform\n";
+    return 1;
+}
+
+int stopDaemon() {
+    std::cerr << "Error: daemon mode requires a POSIX platform\n";
+    return 1;
+}
+
+#endif // _WIN32
+
+} // namespace aurora
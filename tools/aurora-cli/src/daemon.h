@@ -0,0 +1,38 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace aurora {
+
+/// Compile daemon: a long-lived server process that pays LLVM
+/// native-target initialization and the sysroot/module-path scan once,
+/// then serves compile jobs over a local Unix socket. Each job runs in a
+/// forked child that inherits the warm state copy-on-write, so per-job
+/// compiler state (the global CodeGenContext, diagnostics) always starts
+/// fresh and the parent stays clean for the next job.
+
+/// Socket path: $AURORA_CACHE_DIR/daemon.sock, else ~/.cache/aurora/daemon.sock
+std::string daemonSocketPath();
+
+/// Run the compile server in the foreground; returns a process exit code
+int runDaemonServer();
+
+/// Submit a compile job (the original CLI args minus --use-daemon) to a
+/// running daemon, stream its output, and return the job's exit code
+int runDaemonClient(const std::vector<std::string>& args);
+
+/// Ask a running daemon to shut down
+int stopDaemon();
+
+/// Compile (and usually run) one job from already-split CLI args; shared
+/// by the daemon's forked job children and watch mode
+int runCompileJob(const std::vector<std::string>& args);
+
+} // namespace aurora
+
+// Defined in main.cpp (global namespace); the forked job child runs the
+// same compile pipeline as a standalone invocation
+int compileAndRun(std::string_view source, const std::string& filename,
+                  bool emit_llvm, const std::string& output_file,
+                  bool emit_obj, bool emit_exe);
@@ -5,8 +5,11 @@
 #include "aurora/AST.h"
 #include "aurora/Diagnostic.h"
 #include "aurora/Logger.h"
+#include "aurora/SourceBuffer.h"
 #include "aurora/CrashHandler.h"
 #include "aurora/Utils.h"
+#include "daemon.h"
+#include "watch.h"
 #include <iostream>
 #include <fstream>
 #include <sstream>
@@ -21,19 +24,6 @@ using namespace aurora;
 #define AURORA_VERSION_PATCH 3
 #define AURORA_VERSION "0.6.3"
 
-std::string loadFile(const std::string& path) {
-    std::ifstream file(path);
-    if (!file) {
-        auto& diag = getDiagnosticEngine();
-        SourceLocation loc(path, 0, 0, 0);
-        diag.reportError("E0001", "Cannot open file: " + path, loc);
-        return "";
-    }
-    std::stringstream buffer;
-    buffer << file.rdbuf();
-    return buffer.str();
-}
-
 void demonstrateTypeSystem() {
     std::cout << "=== AuroraLang Type System Demo ===" << std::endl;
     
@@ -60,7 +50,7 @@ void demonstrateTypeSystem() {
     std::cout << "  - " << optionalString->toString() << std::endl;
     
     // Function types
-    std::vector<std::shared_ptr<Type>> params = {intType, intType};
+    std::vector<Type*> params = {intType, intType};
     auto funcType = registry.getFunctionType(intType, params);
     
     std::cout << "\nFunction Type:" << std::endl;
@@ -71,7 +61,7 @@ void demonstrateTypeSystem() {
     std::cout << "  - int? is nullable: " << (optionalInt->isNullable() ? "yes" : "no") << std::endl;
 }
 
-void demonstrateLexer(const std::string& source) {
+void demonstrateLexer(std::string_view source) {
     std::cout << "\n=== Lexer Demo ===" << std::endl;
     std::cout << "Source code:\n" << source << std::endl;
     std::cout << "\nTokens:" << std::endl;
@@ -91,7 +81,8 @@ extern "C" double printd(double x) {
     return 0;
 }
 
-int compileAndRun(const std::string& source, const std::string& filename, bool emit_llvm = false, const std::string& output_file = "") {
+int compileAndRun(std::string_view source, const std::string& filename, bool emit_llvm = false, const std::string& output_file = "",
+                  bool emit_obj = false, bool emit_exe = false) {
     auto& diag = getDiagnosticEngine();
     auto& logger = Logger::instance();
     
@@ -100,7 +91,12 @@ int compileAndRun(const std::string& source, const std::string& filename, bool e
     
     // Initialize module system before any compilation
     initializeModuleSystem();
-    
+
+    // All AST nodes for this compilation live in one arena; declared before
+    // the try block so it outlives the node-owning containers inside it
+    ASTArena ast_arena;
+    ASTArenaScope arena_scope(ast_arena);
+
     try {
         logger.info("Starting compilation...");
         logger.debug("Source file: " + filename, "Compiler");
@@ -235,8 +231,19 @@ int compileAndRun(const std::string& source, const std::string& filename, bool e
         }
         logger.debug("Module verification passed", "Codegen");
         
+        // AOT paths: emit a native object file or a linked executable
+        if (emit_obj) {
+            ctx.optimizeModule();
+            return ctx.emitObjectFile(output_file.empty() ? "output.o" : output_file) ? 0 : 1;
+        }
+        if (emit_exe) {
+            ctx.optimizeModule();
+            return ctx.emitExecutable(output_file.empty() ? "a.out" : output_file) ? 0 : 1;
+        }
+
         // Emit LLVM IR if requested
         if (emit_llvm) {
+            ctx.optimizeModule();
             std::string ll_file = output_file.empty() ? "output.ll" : output_file;
             std::error_code ec;
             llvm::raw_fd_ostream out(ll_file, ec);
@@ -300,9 +307,21 @@ void printUsage(const char* prog) {
     std::cerr << "  --trace                 Enable trace mode (most verbose)\n";
     std::cerr << "  --log-level <level>     Set log level: trace|debug|info|warn|error|off\n";
     std::cerr << "  --sysroot <path>        Set system root directory\n";
+    std::cerr << "  -O0, -O1, -O2, -O3      Set optimization level (default: -O2)\n";
+    std::cerr << "  --lazy-jit              Compile functions on first call (fast startup)\n";
+    std::cerr << "  --pgo                   Record a run profile and tune later runs with it\n";
+    std::cerr << "  -mcpu <cpu>             Target CPU (default: native; e.g. generic, skylake)\n";
     std::cerr << "  --lex                   Show lexer tokens only\n";
     std::cerr << "  --emit-llvm             Emit LLVM IR to file (output.ll)\n";
-    std::cerr << "  -o <file>               Specify output file for --emit-llvm\n";
+    std::cerr << "  -c, --emit-obj          Compile to a native object file (output.o)\n";
+    std::cerr << "  --compile               Compile and link a native executable (a.out)\n";
+    std::cerr << "  --daemon                Run as a compile server (warm LLVM/module state)\n";
+    std::cerr << "  --use-daemon            Submit this compile to a running daemon\n";
+    std::cerr << "  --daemon-stop           Shut down a running daemon\n";
+    std::cerr << "  --watch                 Rebuild and rerun when any loaded file changes\n";
+    std::cerr << "  --no-jit-cache          Disable the persistent JIT object cache\n";
+    std::cerr << "  --no-arc-opt            Disable retain/release elision\n";
+    std::cerr << "  -o <file>               Specify output file for --emit-llvm/-c/--compile\n";
     std::cerr << "  --type-demo             Show type system demo\n";
     std::cerr << "\nLog Levels:\n";
     std::cerr << "  trace  - Show all debug information including AST and IR\n";
@@ -321,22 +340,55 @@ void printUsage(const char* prog) {
     std::cerr << "  " << prog << " --sysroot /usr/local program.aur\n";
     std::cerr << "  " << prog << " --emit-llvm program.aur         # Generate LLVM IR\n";
     std::cerr << "  " << prog << " --emit-llvm -o out.ll program.aur\n";
+    std::cerr << "  " << prog << " --compile -o program program.aur # Build native executable\n";
 }
 
 int main(int argc, char** argv) {
     // Setup crash handler for better error reporting
     setupCrashHandler();
-    
+
     if (argc < 2) {
         printUsage(argv[0]);
         return 1;
     }
-    
+
+    // Daemon mode: --daemon serves compile jobs with warm LLVM/module
+    // state; --use-daemon forwards this invocation to a running server
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--daemon") {
+            if (Logger::instance().getLevel() == LogLevel::Off) {
+                Logger::instance().setLevel(LogLevel::Info);
+            }
+            return runDaemonServer();
+        } else if (arg == "--daemon-stop") {
+            return stopDaemon();
+        } else if (arg == "--use-daemon") {
+            std::vector<std::string> job_args;
+            for (int j = 1; j < argc; ++j) {
+                if (std::string(argv[j]) != "--use-daemon") {
+                    job_args.push_back(argv[j]);
+                }
+            }
+            return runDaemonClient(job_args);
+        } else if (arg == "--watch") {
+            std::vector<std::string> job_args;
+            for (int j = 1; j < argc; ++j) {
+                if (std::string(argv[j]) != "--watch") {
+                    job_args.push_back(argv[j]);
+                }
+            }
+            return runWatchMode(job_args);
+        }
+    }
+
     // Parse command line arguments
     std::string filename;
     std::string sysroot_arg;
     bool lex_only = false;
     bool emit_llvm = false;
+    bool emit_obj = false;
+    bool emit_exe = false;
     bool type_demo = false;
     bool debug_mode = false;
     std::string output_file;
@@ -381,10 +433,31 @@ int main(int argc, char** argv) {
                 std::cerr << "Error: --sysroot requires an argument\n";
                 return 1;
             }
+        } else if (arg == "-O0" || arg == "-O1" || arg == "-O2" || arg == "-O3") {
+            getGlobalContext().setOptimizationLevel(arg[2] - '0');
+        } else if (arg == "--lazy-jit") {
+            getGlobalContext().setLazyJIT(true);
+        } else if (arg == "--pgo") {
+            getGlobalContext().setProfileGuidedJIT(true);
+        } else if (arg == "-mcpu" || arg == "--mcpu") {
+            if (i + 1 < argc) {
+                getGlobalContext().setTargetCPU(argv[++i]);
+            } else {
+                std::cerr << "Error: -mcpu requires an argument\n";
+                return 1;
+            }
         } else if (arg == "--lex") {
             lex_only = true;
         } else if (arg == "--emit-llvm") {
             emit_llvm = true;
+        } else if (arg == "-c" || arg == "--emit-obj") {
+            emit_obj = true;
+        } else if (arg == "--compile") {
+            emit_exe = true;
+        } else if (arg == "--no-jit-cache") {
+            getGlobalContext().setJITCacheEnabled(false);
+        } else if (arg == "--no-arc-opt") {
+            getGlobalContext().setARCOptEnabled(false);
         } else if (arg == "-o") {
             if (i + 1 < argc) {
                 output_file = argv[++i];
@@ -420,10 +493,16 @@ int main(int argc, char** argv) {
         return 1;
     }
     
-    std::string source = loadFile(filename);
-    if (source.empty()) {
+    // Sources are memory-mapped; the buffer must stay alive for as long
+    // as the Lexer's tokens are in use
+    auto source_buffer = SourceBuffer::open(filename);
+    if (!source_buffer) {
+        auto& diag = getDiagnosticEngine();
+        SourceLocation loc(filename, 0, 0, 0);
+        diag.reportError("E0001", "Cannot open file: " + filename, loc);
         return 1;
     }
+    std::string_view source = source_buffer->contents();
     
     if (lex_only) {
         demonstrateLexer(source);
@@ -431,7 +510,7 @@ int main(int argc, char** argv) {
     }
     
     // Compile and run (or emit IR)
-    int exit_code = compileAndRun(source, filename, emit_llvm, output_file);
+    int exit_code = compileAndRun(source, filename, emit_llvm, output_file, emit_obj, emit_exe);
     std::cout.flush();
     std::cerr.flush();
     
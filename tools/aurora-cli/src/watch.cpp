@@ -0,0 +1,163 @@
+#include "watch.h"
+#include "daemon.h"
+#include "aurora/AST.h"
+#include "aurora/Logger.h"
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <llvm/Support/TargetSelect.h>
+
+#ifndef _WIN32
+#include <chrono>
+#include <filesystem>
+#include <map>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+#endif
+
+namespace aurora {
+
+#ifndef _WIN32
+
+// How often the dependency set is polled for changes
+static constexpr auto kPollInterval = std::chrono::milliseconds(200);
+
+// ============================================================================
+// Dependency Reporting (forked child)
+// ============================================================================
+// The dependency set is only known inside the job child, after the
+// ModuleLoader has resolved every import; compileAndRun exits the
+// process when the program finishes, so the list is written back to the
+// parent from an atexit handler over a pipe.
+
+static int g_dep_fd = -1;
+
+static void reportDependenciesAtExit() {
+    if (g_dep_fd < 0) return;
+    FILE* out = ::fdopen(g_dep_fd, "w");
+    if (!out) return;
+    for (const auto& file : getLoadedModuleFiles()) {
+        std::fprintf(out, "%s\n", file.c_str());
+    }
+    std::fclose(out);
+}
+
+// ============================================================================
+// Watch Loop
+// ============================================================================
+
+// mtime of a file, or epoch when it does not exist (a deleted dependency
+// counts as a change)
+static std::filesystem::file_time_type mtimeOf(const std::string& path) {
+    std::error_code ec;
+    auto time = std::filesystem::last_write_time(path, ec);
+    return ec ? std::filesystem::file_time_type{} : time;
+}
+
+int runWatchMode(const std::vector<std::string>& args) {
+    std::string root_file;
+    for (size_t i = 0; i < args.size(); i++) {
+        if (args[i] == "--log-level" || args[i] == "-o" || args[i] == "--sysroot") {
+            i++;
+        } else if (!args[i].empty() && args[i][0] != '-') {
+            root_file = args[i];
+        }
+    }
+    if (root_file.empty()) {
+        std::cerr << "Error: --watch requires an input file\n";
+        return 1;
+    }
+
+    // Warm state every rebuild inherits through fork
+    llvm::InitializeNativeTarget();
+    llvm::InitializeNativeTargetAsmPrinter();
+    llvm::InitializeNativeTargetAsmParser();
+    initializeModuleSystem();
+
+    std::cerr << "[watch] watching " << root_file << " (Ctrl-C to stop)\n";
+
+    std::map<std::string, std::filesystem::file_time_type> watched;
+    while (true) {
+        int dep_pipe[2];
+        if (::pipe(dep_pipe) != 0) {
+            std::cerr << "Error: cannot create watch pipe\n";
+            return 1;
+        }
+
+        auto build_start = std::chrono::steady_clock::now();
+        pid_t pid = ::fork();
+        if (pid == 0) {
+            ::close(dep_pipe[0]);
+            g_dep_fd = dep_pipe[1];
+            std::atexit(reportDependenciesAtExit);
+            std::exit(runCompileJob(args));
+        }
+        ::close(dep_pipe[1]);
+
+        if (pid < 0) {
+            ::close(dep_pipe[0]);
+            std::cerr << "Error: fork failed\n";
+            return 1;
+        }
+
+        // Rebuild the watch set from what this compilation actually
+        // loaded, so newly added imports are picked up automatically
+        watched.clear();
+        watched[root_file] = {};
+        {
+            FILE* in = ::fdopen(dep_pipe[0], "r");
+            if (in) {
+                char line[4096];
+                while (std::fgets(line, sizeof(line), in)) {
+                    std::string path(line);
+                    while (!path.empty() && (path.back() == '\n' || path.back() == '\r')) {
+                        path.pop_back();
+                    }
+                    if (!path.empty()) watched[path] = {};
+                }
+                std::fclose(in);
+            } else {
+                ::close(dep_pipe[0]);
+            }
+        }
+
+        int status = 0;
+        ::waitpid(pid, &status, 0);
+        int exit_code = WIFEXITED(status) ? WEXITSTATUS(status) : 1;
+
+        auto build_ms = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - build_start).count();
+        std::fprintf(stderr, "[watch] run finished (exit %d, %.0f ms, %zu files watched)\n",
+                     exit_code, build_ms, watched.size());
+
+        for (auto& [path, mtime] : watched) {
+            mtime = mtimeOf(path);
+        }
+
+        // Poll until any watched file changes
+        bool changed = false;
+        while (!changed) {
+            std::this_thread::sleep_for(kPollInterval);
+            for (auto& [path, mtime] : watched) {
+                auto now = mtimeOf(path);
+                if (now != mtime) {
+                    std::cerr << "[watch] " << path << " changed, rebuilding...\n";
+                    changed = true;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+#else // _WIN32
+
+int runWatchMode(const std::vector<std::string>&) {
+    std::cerr << "Error: watch mode requires a POSIX platform\n";
+    return 1;
+}
+
+#endif // _WIN32
+
+} // namespace aurora
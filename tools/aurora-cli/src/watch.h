@@ -0,0 +1,16 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace aurora {
+
+/// Watch mode: compile and run once, discover the full dependency set
+/// (the root file plus every .aur file the ModuleLoader resolved), then
+/// poll mtimes and rebuild whenever any of them changes. Each rebuild
+/// runs in a forked child so it starts from a clean compiler context
+/// while inheriting the parent's warm LLVM and module-system state;
+/// unchanged compilations re-JIT through the persistent object cache.
+int runWatchMode(const std::vector<std::string>& args);
+
+} // namespace aurora
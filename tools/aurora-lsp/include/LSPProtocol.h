@@ -11,10 +11,25 @@ using json = nlohmann::json;
 /// LSP Protocol conversion utilities
 class LSPProtocol {
 public:
+    /// Pre-parsed fields of the hot document notifications (didOpen and
+    /// full-sync didChange), extracted in one streaming pass without
+    /// building a DOM of the whole message
+    struct DocumentEdit {
+        std::string method;
+        std::string uri;
+        std::string text;  // full document text
+    };
+
+    /// Streaming (SAX) parse of a message body. Returns true when the
+    /// message is one of the hot document notifications and `edit` holds
+    /// everything its handler needs; any other method (or shape) aborts
+    /// early and the caller falls back to the DOM path.
+    static bool parseDocumentEdit(const std::string& body, DocumentEdit& edit);
+
     // URI conversions
     static std::string uriToPath(const std::string& uri);
     static std::string pathToUri(const std::string& path);
-    
+
     // LSP object conversions
     static json locationToLSP(const SourceLocation& loc);
     static json rangeToLSP(const SourceLocation& loc);
@@ -3,8 +3,15 @@
 #include "aurora/LanguageCore.h"
 #include "LSPHandlers.h"
 #include "LSPProtocol.h"
-#include <string>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
 #include <nlohmann/json.hpp>
 
 namespace aurora {
@@ -13,39 +20,90 @@ namespace lsp {
 using json = nlohmann::json;
 
 /// LSP Server - Protocol adapter for Language Core
+///
+/// Two threads: the I/O thread reads messages and only handles
+/// '$/cancelRequest' and 'exit' inline; everything else is queued for a
+/// single worker thread that owns the LanguageCore, so interactive
+/// requests never compete with stdin reading and no locking is needed
+/// inside the analyzer. didChange applies the new text immediately but
+/// defers analysis behind a short per-document debounce, so fast typing
+/// coalesces into one analysis and one diagnostics publication; a
+/// request that targets a document with deferred analysis flushes it
+/// first so results are never stale.
+///
+/// The hot notifications (didOpen, full-sync didChange) never become a
+/// DOM: the I/O thread extracts their three fields with a streaming
+/// parse and the document text is moved, not copied, down to the
+/// analyzer. Read and write buffers are reused across messages.
 class LSPServer {
 public:
     LSPServer();
     ~LSPServer();
-    
+
     void run();
-    
+
 private:
+    // One queued unit of work: either a pre-parsed document edit (hot
+    // path) or a full DOM (everything else)
+    struct QueuedMessage {
+        json dom;
+        LSPProtocol::DocumentEdit edit;
+        bool isEdit = false;
+    };
+
     LanguageCore core_;
     LSPHandlers handlers_;
-    bool running_;
-    std::map<std::string, std::string> openDocuments_;
-    
+    std::atomic<bool> running_;
+
+    // Request queue (I/O thread produces, worker consumes)
+    std::thread worker_;
+    std::deque<QueuedMessage> queue_;
+    std::mutex queue_mutex_;
+    std::condition_variable queue_cv_;
+
+    // Ids from $/cancelRequest, keyed by their JSON text so both integer
+    // and string ids work; checked by the worker before executing
+    std::set<std::string> cancelled_;
+    std::mutex cancel_mutex_;
+
+    // Documents edited but not yet re-analyzed, with the time analysis
+    // becomes due; guarded by queue_mutex_
+    std::map<std::string, std::chrono::steady_clock::time_point> pendingAnalysis_;
+
+    // Serializes stdout writes (worker responses and diagnostics)
+    std::mutex write_mutex_;
+
+    // Reused message buffers: read_buffer_/header_line_ belong to the
+    // I/O thread, write_buffer_ is guarded by write_mutex_
+    std::string read_buffer_;
+    std::string header_line_;
+    std::string write_buffer_;
+
+    // Worker thread
+    void workerLoop();
+    void enqueue(QueuedMessage message);
+    bool isCancelled(const json& id);
+    void flushPendingAnalysis(const std::string& uri);
+    void runDeferredAnalysis();
+
     // Message handling
-    void handleMessage(const json& message);
+    void handleMessage(QueuedMessage& message);
     void handleRequest(const json& request);
     void handleNotification(const json& notification);
-    
+
     // Document notifications
     void handleInitialized(const json& params);
-    void handleExit(const json& params);
-    void handleDidOpen(const json& params);
-    void handleDidChange(const json& params);
+    void handleDocumentEdit(LSPProtocol::DocumentEdit& edit);
     void handleDidClose(const json& params);
     void handleDidSave(const json& params);
-    
+
     // Communication
     void sendResponse(const json& id, const json& result);
     void sendError(const json& id, int code, const std::string& message);
     void sendNotification(const std::string& method, const json& params);
     void sendDiagnostics(const std::string& uri);
-    
-    std::string readMessage();
+
+    bool readMessage(std::string& body);
     void writeMessage(const std::string& content);
 };
 
@@ -5,6 +5,18 @@ namespace aurora {
 namespace lsp {
 
 json LSPHandlers::handleInitialize(const json& params) {
+    // Restore the persistent symbol index for this workspace so
+    // workspace/symbol answers immediately, before any file is opened
+    std::string root;
+    if (params.contains("rootUri") && params["rootUri"].is_string()) {
+        root = LSPProtocol::uriToPath(params["rootUri"]);
+    } else if (params.contains("rootPath") && params["rootPath"].is_string()) {
+        root = params["rootPath"];
+    }
+    if (!root.empty()) {
+        core_.loadWorkspaceIndex(root);
+    }
+
     return {
         {"capabilities", {
             {"textDocumentSync", {
@@ -34,6 +46,8 @@ json LSPHandlers::handleInitialize(const json& params) {
 }
 
 json LSPHandlers::handleShutdown(const json& params) {
+    // Persist the symbol index so the next session starts warm
+    core_.saveWorkspaceIndex();
     return nullptr;
 }
 
@@ -3,6 +3,106 @@
 namespace aurora {
 namespace lsp {
 
+// ===== Streaming Notification Parsing =====
+
+namespace {
+
+/// SAX handler that pulls `method`, the document `uri` and the full
+/// document `text` out of a didOpen / full-sync didChange notification
+/// while the parser streams over the body. The first non-hot method
+/// aborts the parse immediately (methods precede params in practice, so
+/// requests pay for a few tokens, not the whole message), and large
+/// string values are moved out of the parser rather than copied into a
+/// DOM.
+class DocumentEditSax : public json::json_sax_t {
+public:
+    explicit DocumentEditSax(LSPProtocol::DocumentEdit& edit) : edit_(edit) {}
+
+    bool key(string_t& val) override {
+        if (!in_params_) {
+            if (val == "method") {
+                pending_ = Field::Method;
+            } else if (val == "params") {
+                in_params_ = true;
+            }
+        } else if (val == "uri") {
+            pending_ = Field::Uri;
+        } else if (val == "text") {
+            pending_ = Field::Text;
+        } else {
+            pending_ = Field::None;
+        }
+        return true;
+    }
+
+    bool string(string_t& val) override {
+        switch (pending_) {
+            case Field::Method:
+                edit_.method = std::move(val);
+                // Anything but the hot notifications: stop parsing here
+                // and let the caller take the DOM path
+                if (edit_.method != "textDocument/didOpen" &&
+                    edit_.method != "textDocument/didChange") {
+                    return false;
+                }
+                break;
+            case Field::Uri:
+                if (edit_.uri.empty()) {
+                    edit_.uri = std::move(val);
+                }
+                break;
+            case Field::Text:
+                // First text wins: didOpen has exactly one, and with full
+                // document sync the first change carries the whole text
+                if (!have_text_) {
+                    edit_.text = std::move(val);
+                    have_text_ = true;
+                }
+                break;
+            case Field::None:
+                break;
+        }
+        pending_ = Field::None;
+        return true;
+    }
+
+    bool complete() const {
+        return !edit_.method.empty() && !edit_.uri.empty() && have_text_;
+    }
+
+    // Remaining events just clear any pending field
+    bool null() override { pending_ = Field::None; return true; }
+    bool boolean(bool) override { pending_ = Field::None; return true; }
+    bool number_integer(number_integer_t) override { pending_ = Field::None; return true; }
+    bool number_unsigned(number_unsigned_t) override { pending_ = Field::None; return true; }
+    bool number_float(number_float_t, const string_t&) override { pending_ = Field::None; return true; }
+    bool binary(binary_t&) override { pending_ = Field::None; return true; }
+    bool start_object(std::size_t) override { return true; }
+    bool end_object() override { return true; }
+    bool start_array(std::size_t) override { return true; }
+    bool end_array() override { return true; }
+    bool parse_error(std::size_t, const std::string&, const json::exception&) override {
+        return false;
+    }
+
+private:
+    enum class Field { None, Method, Uri, Text };
+
+    LSPProtocol::DocumentEdit& edit_;
+    Field pending_ = Field::None;
+    bool in_params_ = false;
+    bool have_text_ = false;
+};
+
+} // namespace
+
+bool LSPProtocol::parseDocumentEdit(const std::string& body, DocumentEdit& edit) {
+    DocumentEditSax handler(edit);
+    // An aborted parse (wrong method, malformed body) returns false; the
+    // caller re-parses as a DOM, which reports malformed JSON as before
+    return json::sax_parse(body, &handler) && handler.complete();
+}
+
 std::string LSPProtocol::uriToPath(const std::string& uri) {
     if (uri.find("file://") == 0) {
         return uri.substr(7);
@@ -1,59 +1,182 @@
 #include "LSPServer.h"
 #include "aurora/Logger.h"
 #include <iostream>
-#include <sstream>
 
 namespace aurora {
 namespace lsp {
 
+// Quiet period after the last edit before a document is re-analyzed and
+// diagnostics are published
+static constexpr auto kDiagnosticsDebounce = std::chrono::milliseconds(200);
+
+// LSP error code for a request cancelled via $/cancelRequest
+static constexpr int kRequestCancelled = -32800;
+
 LSPServer::LSPServer() : handlers_(core_), running_(false) {
     Logger::instance().debug("LSP Server initialized");
 }
 
-LSPServer::~LSPServer() = default;
+LSPServer::~LSPServer() {
+    if (worker_.joinable()) {
+        running_ = false;
+        queue_cv_.notify_all();
+        worker_.join();
+    }
+}
 
 void LSPServer::run() {
     running_ = true;
+    worker_ = std::thread(&LSPServer::workerLoop, this);
     Logger::instance().debug("LSP Server started");
-    
+
+    // I/O thread: read and enqueue. Only cancellation and exit are
+    // handled here so they take effect even while the worker is busy.
     while (running_) {
         try {
-            std::string message = readMessage();
-            if (message.empty()) {
+            if (!readMessage(read_buffer_)) {
+                break;
+            }
+
+            // Hot path: document notifications are extracted in one
+            // streaming pass and the body never becomes a DOM
+            QueuedMessage message;
+            if (LSPProtocol::parseDocumentEdit(read_buffer_, message.edit)) {
+                message.isEdit = true;
+                enqueue(std::move(message));
+                continue;
+            }
+
+            json j = json::parse(read_buffer_);
+            std::string method = j.value("method", "");
+
+            if (method == "$/cancelRequest") {
+                json id = j.value("params", json::object()).value("id", json());
+                {
+                    std::lock_guard<std::mutex> lock(cancel_mutex_);
+                    cancelled_.insert(id.dump());
+                }
+                queue_cv_.notify_all();
+            } else if (method == "exit") {
                 break;
+            } else {
+                message.dom = std::move(j);
+                enqueue(std::move(message));
             }
-            
-            json j = json::parse(message);
-            handleMessage(j);
-            
+
         } catch (const std::exception& e) {
             Logger::instance().error(std::string("Error processing message: ") + e.what());
         }
     }
-    
+
+    running_ = false;
+    queue_cv_.notify_all();
+    worker_.join();
+
     Logger::instance().debug("LSP Server stopped");
 }
 
-void LSPServer::handleMessage(const json& message) {
-    if (message.contains("method")) {
-        if (message.contains("id")) {
-            handleRequest(message);
+void LSPServer::enqueue(QueuedMessage message) {
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+
+        // Coalesce edits: a newer didChange for the same document makes
+        // any queued one stale, so replace it in place (pre-parsed edits
+        // make this a pair of string compares)
+        if (message.isEdit && message.edit.method == "textDocument/didChange") {
+            for (auto& queued : queue_) {
+                if (queued.isEdit &&
+                    queued.edit.method == "textDocument/didChange" &&
+                    queued.edit.uri == message.edit.uri) {
+                    queued = std::move(message);
+                    queue_cv_.notify_all();
+                    return;
+                }
+            }
+        }
+
+        queue_.push_back(std::move(message));
+    }
+    queue_cv_.notify_all();
+}
+
+void LSPServer::workerLoop() {
+    while (true) {
+        QueuedMessage message;
+        {
+            std::unique_lock<std::mutex> lock(queue_mutex_);
+
+            // Sleep until work arrives or the earliest debounce deadline
+            // passes; an empty queue with an expired deadline means it is
+            // time to analyze
+            while (queue_.empty() && running_) {
+                if (pendingAnalysis_.empty()) {
+                    queue_cv_.wait(lock);
+                } else {
+                    auto deadline = pendingAnalysis_.begin()->second;
+                    for (const auto& [uri, due] : pendingAnalysis_) {
+                        if (due < deadline) deadline = due;
+                    }
+                    if (std::chrono::steady_clock::now() >= deadline) break;
+                    queue_cv_.wait_until(lock, deadline);
+                }
+            }
+
+            if (queue_.empty()) {
+                if (!running_) return;
+                lock.unlock();
+                runDeferredAnalysis();
+                continue;
+            }
+
+            message = std::move(queue_.front());
+            queue_.pop_front();
+        }
+
+        handleMessage(message);
+    }
+}
+
+void LSPServer::handleMessage(QueuedMessage& message) {
+    if (message.isEdit) {
+        handleDocumentEdit(message.edit);
+        return;
+    }
+    if (message.dom.contains("method")) {
+        if (message.dom.contains("id")) {
+            handleRequest(message.dom);
         } else {
-            handleNotification(message);
+            handleNotification(message.dom);
         }
     }
 }
 
+bool LSPServer::isCancelled(const json& id) {
+    std::lock_guard<std::mutex> lock(cancel_mutex_);
+    return cancelled_.erase(id.dump()) > 0;
+}
+
 void LSPServer::handleRequest(const json& request) {
     std::string method = request["method"];
     json id = request["id"];
     json params = request.value("params", json::object());
-    
+
     Logger::instance().debug("Request: " + method);
-    
+
+    // The client may have cancelled while this request sat in the queue
+    if (isCancelled(id)) {
+        sendError(id, kRequestCancelled, "Request cancelled: " + method);
+        return;
+    }
+
+    // Requests read analysis results, so a document with a deferred
+    // re-analysis must be brought up to date first
+    if (params.contains("textDocument")) {
+        flushPendingAnalysis(params["textDocument"].value("uri", ""));
+    }
+
     try {
         json result;
-        
+
         // Delegate to handlers
         if (method == "initialize") {
             result = handlers_.handleInitialize(params);
@@ -81,9 +204,9 @@ void LSPServer::handleRequest(const json& request) {
             sendError(id, -32601, "Method not found: " + method);
             return;
         }
-        
+
         sendResponse(id, result);
-        
+
     } catch (const std::exception& e) {
         sendError(id, -32603, std::string("Internal error: ") + e.what());
     }
@@ -92,18 +215,29 @@ void LSPServer::handleRequest(const json& request) {
 void LSPServer::handleNotification(const json& notification) {
     std::string method = notification["method"];
     json params = notification.value("params", json::object());
-    
+
     Logger::instance().debug("Notification: " + method);
-    
+
     try {
         if (method == "initialized") {
             handleInitialized(params);
-        } else if (method == "exit") {
-            handleExit(params);
         } else if (method == "textDocument/didOpen") {
-            handleDidOpen(params);
+            // DOM fallback for clients the streaming extractor rejects
+            // (e.g. unusual key ordering)
+            LSPProtocol::DocumentEdit edit;
+            edit.method = method;
+            edit.uri = params["textDocument"]["uri"];
+            edit.text = params["textDocument"]["text"];
+            handleDocumentEdit(edit);
         } else if (method == "textDocument/didChange") {
-            handleDidChange(params);
+            const json& changes = params["contentChanges"];
+            if (!changes.empty() && changes[0].contains("text")) {
+                LSPProtocol::DocumentEdit edit;
+                edit.method = method;
+                edit.uri = params["textDocument"]["uri"];
+                edit.text = changes[0]["text"];
+                handleDocumentEdit(edit);
+            }
         } else if (method == "textDocument/didClose") {
             handleDidClose(params);
         } else if (method == "textDocument/didSave") {
@@ -118,51 +252,74 @@ void LSPServer::handleInitialized(const json& params) {
     Logger::instance().debug("Server initialized");
 }
 
-void LSPServer::handleExit(const json& params) {
-    running_ = false;
+void LSPServer::handleDocumentEdit(LSPProtocol::DocumentEdit& edit) {
+    std::string path = LSPProtocol::uriToPath(edit.uri);
+
+    // The document text is moved into the analyzer, not copied
+    core_.setSource(path, std::move(edit.text));
+
+    if (edit.method == "textDocument/didOpen") {
+        core_.analyze(path);
+        sendDiagnostics(edit.uri);
+        return;
+    }
+
+    // didChange: defer analysis - another keystroke within the debounce
+    // window just pushes the deadline back, so a burst of edits costs
+    // one analysis and one diagnostics publication
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    pendingAnalysis_[edit.uri] = std::chrono::steady_clock::now() + kDiagnosticsDebounce;
 }
 
-void LSPServer::handleDidOpen(const json& params) {
-    std::string uri = params["textDocument"]["uri"];
-    std::string text = params["textDocument"]["text"];
-    
-    std::string path = LSPProtocol::uriToPath(uri);
-    openDocuments_[uri] = text;
-    
-    core_.setSource(path, text);
-    core_.analyze(path);
-    
+void LSPServer::flushPendingAnalysis(const std::string& uri) {
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        if (pendingAnalysis_.erase(uri) == 0) {
+            return;
+        }
+    }
+    core_.analyze(LSPProtocol::uriToPath(uri));
     sendDiagnostics(uri);
 }
 
-void LSPServer::handleDidChange(const json& params) {
-    std::string uri = params["textDocument"]["uri"];
-    json changes = params["contentChanges"];
-    
-    // Full document sync
-    if (!changes.empty() && changes[0].contains("text")) {
-        std::string text = changes[0]["text"];
-        openDocuments_[uri] = text;
-        
-        std::string path = LSPProtocol::uriToPath(uri);
-        core_.setSource(path, text);
-        core_.analyze(path);
-        
+void LSPServer::runDeferredAnalysis() {
+    std::vector<std::string> due;
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        auto now = std::chrono::steady_clock::now();
+        for (auto it = pendingAnalysis_.begin(); it != pendingAnalysis_.end();) {
+            if (now >= it->second) {
+                due.push_back(it->first);
+                it = pendingAnalysis_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+    for (const auto& uri : due) {
+        core_.analyze(LSPProtocol::uriToPath(uri));
         sendDiagnostics(uri);
     }
 }
 
 void LSPServer::handleDidClose(const json& params) {
     std::string uri = params["textDocument"]["uri"];
-    
-    openDocuments_.erase(uri);
+
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        pendingAnalysis_.erase(uri);
+    }
     core_.clearSource(LSPProtocol::uriToPath(uri));
 }
 
 void LSPServer::handleDidSave(const json& params) {
     std::string uri = params["textDocument"]["uri"];
     std::string path = LSPProtocol::uriToPath(uri);
-    
+
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        pendingAnalysis_.erase(uri);
+    }
     core_.analyze(path);
     sendDiagnostics(uri);
 }
@@ -173,7 +330,7 @@ void LSPServer::sendResponse(const json& id, const json& result) {
         {"id", id},
         {"result", result}
     };
-    
+
     writeMessage(response.dump());
 }
 
@@ -186,7 +343,7 @@ void LSPServer::sendError(const json& id, int code, const std::string& message)
             {"message", message}
         }}
     };
-    
+
     writeMessage(response.dump());
 }
 
@@ -196,59 +353,69 @@ void LSPServer::sendNotification(const std::string& method, const json& params)
         {"method", method},
         {"params", params}
     };
-    
+
     writeMessage(notification.dump());
 }
 
 void LSPServer::sendDiagnostics(const std::string& uri) {
     std::string path = LSPProtocol::uriToPath(uri);
     auto diagnostics = core_.getDiagnostics(path);
-    
+
     json diags = json::array();
     for (const auto& diag : diagnostics) {
         diags.push_back(LSPProtocol::diagnosticToLSP(diag));
     }
-    
+
     sendNotification("textDocument/publishDiagnostics", {
         {"uri", uri},
         {"diagnostics", diags}
     });
 }
 
-std::string LSPServer::readMessage() {
-    std::string headers;
-    std::string line;
+bool LSPServer::readMessage(std::string& body) {
     size_t contentLength = 0;
-    
-    // Read headers
-    while (std::getline(std::cin, line)) {
-        if (line == "\r" || line.empty()) {
+
+    // Read headers into a reused line buffer
+    while (std::getline(std::cin, header_line_)) {
+        if (header_line_ == "\r" || header_line_.empty()) {
             break;
         }
-        
-        if (line.find("Content-Length:") == 0) {
-            contentLength = std::stoul(line.substr(15));
+
+        if (header_line_.find("Content-Length:") == 0) {
+            contentLength = std::stoul(header_line_.substr(15));
         }
     }
-    
+
     if (contentLength == 0) {
-        return "";
+        return false;
+    }
+
+    // Read the body into the reused buffer; resize keeps the capacity
+    // from earlier messages, so steady-state reads allocate nothing.
+    // Loop on gcount in case the stream delivers the body in pieces.
+    body.resize(contentLength);
+    size_t total = 0;
+    while (total < contentLength && std::cin) {
+        std::cin.read(&body[0] + total, contentLength - total);
+        total += static_cast<size_t>(std::cin.gcount());
     }
-    
-    // Read content
-    std::string content(contentLength, '\0');
-    std::cin.read(&content[0], contentLength);
-    
-    return content;
+    return total == contentLength;
 }
 
 void LSPServer::writeMessage(const std::string& content) {
-    std::ostringstream oss;
-    oss << "Content-Length: " << content.length() << "\r\n";
-    oss << "\r\n";
-    oss << content;
-    
-    std::cout << oss.str() << std::flush;
+    std::lock_guard<std::mutex> lock(write_mutex_);
+
+    // Frame into the reused write buffer and issue one write, so a
+    // concurrent writer can never interleave header and body
+    write_buffer_.clear();
+    write_buffer_ += "Content-Length: ";
+    write_buffer_ += std::to_string(content.length());
+    write_buffer_ += "\r\n\r\n";
+    write_buffer_ += content;
+
+    std::cout.write(write_buffer_.data(),
+                    static_cast<std::streamsize>(write_buffer_.size()));
+    std::cout.flush();
 }
 
 } // namespace lsp